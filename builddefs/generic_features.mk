@@ -34,6 +34,7 @@ GENERIC_FEATURES = \
     DYNAMIC_TAPPING_TERM \
     GRAVE_ESC \
     HAPTIC \
+    KEY_LATENCY \
     KEY_LOCK \
     KEY_OVERRIDE \
     LEADER \
@@ -41,6 +42,7 @@ GENERIC_FEATURES = \
     MOUSEKEY \
     MUSIC \
     OS_DETECTION \
+    PROFILING \
     PROGRAMMABLE_BUTTON \
     REPEAT_KEY \
     SECURE \
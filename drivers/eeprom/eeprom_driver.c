@@ -19,6 +19,10 @@
 
 #include "eeprom_driver.h"
 
+#ifndef EEPROM_DRIVER_UPDATE_CHUNK_SIZE
+#    define EEPROM_DRIVER_UPDATE_CHUNK_SIZE 32
+#endif
+
 uint8_t eeprom_read_byte(const uint8_t *addr) {
     uint8_t ret = 0;
     eeprom_read_block(&ret, addr, 1);
@@ -50,10 +54,32 @@ void eeprom_write_dword(uint32_t *addr, uint32_t value) {
 }
 
 void eeprom_update_block(const void *buf, void *addr, size_t len) {
-    uint8_t read_buf[len];
-    eeprom_read_block(read_buf, addr, len);
-    if (memcmp(buf, read_buf, len) != 0) {
-        eeprom_write_block(buf, addr, len);
+    const uint8_t *source = (const uint8_t *)buf;
+    uintptr_t      target = (uintptr_t)addr;
+    uint8_t        read_buf[EEPROM_DRIVER_UPDATE_CHUNK_SIZE];
+    size_t         first_changed = len;
+    size_t         last_changed  = 0;
+
+    // Compare against the current contents using bulk reads, keeping track of the changed span
+    for (size_t offset = 0; offset < len; offset += EEPROM_DRIVER_UPDATE_CHUNK_SIZE) {
+        size_t chunk = len - offset < EEPROM_DRIVER_UPDATE_CHUNK_SIZE ? len - offset : EEPROM_DRIVER_UPDATE_CHUNK_SIZE;
+        eeprom_read_block(read_buf, (const void *)(target + offset), chunk);
+        if (memcmp(&source[offset], read_buf, chunk) == 0) {
+            continue;
+        }
+        for (size_t i = 0; i < chunk; ++i) {
+            if (source[offset + i] != read_buf[i]) {
+                if (first_changed == len) {
+                    first_changed = offset + i;
+                }
+                last_changed = offset + i;
+            }
+        }
+    }
+
+    // Only the changed span gets written, as a single block write
+    if (first_changed < len) {
+        eeprom_write_block(&source[first_changed], (void *)(target + first_changed), last_changed - first_changed + 1);
     }
 }
 
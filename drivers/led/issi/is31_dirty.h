@@ -0,0 +1,81 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Dirty register tracking shared by the ISSI drivers.
+// Every register of a buffer has a bit in a bitmap, and flushing sends each run of
+// changed registers as a single auto-increment write instead of the whole page.
+
+// Runs separated by up to this many unchanged registers are sent together, as
+// resending them is cheaper than the device and register address of a new write.
+#ifndef IS31_DIRTY_MERGE_GAP
+#    define IS31_DIRTY_MERGE_GAP 2
+#endif
+
+// Longest single write, matching the 16 byte transfers the drivers used before
+// dirty tracking, so a fully changed page does not become one large transfer.
+#ifndef IS31_DIRTY_MAX_RUN
+#    define IS31_DIRTY_MAX_RUN 16
+#endif
+
+#define IS31_DIRTY_BITMAP_SIZE(register_count) (((register_count) + 7) / 8)
+
+typedef void (*is31_write_run_t)(uint8_t index, uint8_t reg, uint8_t *data, uint16_t length);
+
+static inline void is31_dirty_set(uint8_t *dirty, uint16_t reg) {
+    dirty[reg / 8] |= 1 << (reg % 8);
+}
+
+/**
+ * Stores `value` in register `reg` of `buffer`, marking it dirty only if it changed.
+ */
+static inline void is31_dirty_update(uint8_t *buffer, uint8_t *dirty, uint16_t reg, uint8_t value) {
+    if (buffer[reg] != value) {
+        buffer[reg] = value;
+        is31_dirty_set(dirty, reg);
+    }
+}
+
+static inline bool is31_dirty_get(const uint8_t *dirty, uint16_t reg) {
+    return (dirty[reg / 8] & (1 << (reg % 8))) != 0;
+}
+
+static inline bool is31_dirty_any(const uint8_t *dirty, uint16_t register_count) {
+    for (uint16_t i = 0; i < IS31_DIRTY_BITMAP_SIZE(register_count); i++) {
+        if (dirty[i]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * Calls `write` for every run of dirty registers of `buffer`, split into writes of at
+ * most IS31_DIRTY_MAX_RUN registers, then clears `dirty`.
+ */
+static inline void is31_dirty_flush(uint8_t index, uint8_t *buffer, uint8_t *dirty, uint16_t register_count, is31_write_run_t write) {
+    uint16_t reg = 0;
+    while (reg < register_count) {
+        if (!is31_dirty_get(dirty, reg)) {
+            // Skip clean bytes of the bitmap at once
+            reg = (reg % 8 == 0 && dirty[reg / 8] == 0) ? reg + 8 : reg + 1;
+            continue;
+        }
+
+        uint16_t start = reg;
+        uint16_t end   = reg + 1;
+        for (reg = end; reg < register_count && reg - end < IS31_DIRTY_MERGE_GAP + 1 && reg - start < IS31_DIRTY_MAX_RUN; reg++) {
+            if (is31_dirty_get(dirty, reg)) {
+                end = reg + 1;
+            }
+        }
+        write(index, start, buffer + start, end - start);
+        reg = end;
+    }
+    memset(dirty, 0, IS31_DIRTY_BITMAP_SIZE(register_count));
+}
@@ -17,6 +17,7 @@
 #include "is31fl3218-mono.h"
 #include "i2c_master.h"
 #include "gpio.h"
+#include "is31_dirty.h"
 
 #define IS31FL3218_PWM_REGISTER_COUNT 18
 #define IS31FL3218_LED_CONTROL_REGISTER_COUNT 3
@@ -31,7 +32,7 @@
 
 typedef struct is31fl3218_driver_t {
     uint8_t pwm_buffer[IS31FL3218_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[IS31_DIRTY_BITMAP_SIZE(IS31FL3218_PWM_REGISTER_COUNT)];
     uint8_t led_control_buffer[IS31FL3218_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3218_driver_t;
@@ -39,12 +40,15 @@ typedef struct is31fl3218_driver_t {
 // IS31FL3218 has 18 PWM outputs and a fixed I2C address, so no chaining.
 is31fl3218_driver_t driver_buffers = {
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 };
 
+static uint32_t bytes_written = 0;
+
 void is31fl3218_write_register(uint8_t reg, uint8_t data) {
+    bytes_written += 2;
 #if IS31FL3218_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
         if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, reg, &data, 1, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -54,16 +58,21 @@ void is31fl3218_write_register(uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3218_write_pwm_buffer(void) {
+static void is31fl3218_write_pwm_run(uint8_t index, uint8_t reg, uint8_t *data, uint16_t length) {
+    bytes_written += 1 + length;
 #if IS31FL3218_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3218_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        if (i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + reg, data, length, IS31FL3218_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
     }
 #else
-    i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM, driver_buffers.pwm_buffer, 18, IS31FL3218_I2C_TIMEOUT);
+    i2c_write_register(IS31FL3218_I2C_ADDRESS << 1, IS31FL3218_REG_PWM + reg, data, length, IS31FL3218_I2C_TIMEOUT);
 #endif
 }
 
+void is31fl3218_write_pwm_buffer(void) {
+    is31fl3218_write_pwm_run(0, 0, driver_buffers.pwm_buffer, 18);
+}
+
 void is31fl3218_init(void) {
     i2c_init();
 
@@ -104,12 +113,7 @@ void is31fl3218_set_value(int index, uint8_t value) {
     if (index >= 0 && index < IS31FL3218_LED_COUNT) {
         memcpy_P(&led, (&g_is31fl3218_leds[index]), sizeof(led));
 
-        if (driver_buffers.pwm_buffer[led.v] == value) {
-            return;
-        }
-
-        driver_buffers.pwm_buffer[led.v] = value;
-        driver_buffers.pwm_buffer_dirty  = true;
+        is31_dirty_update(driver_buffers.pwm_buffer, driver_buffers.pwm_buffer_dirty, led.v, value);
     }
 }
 
@@ -136,12 +140,11 @@ void is31fl3218_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3218_update_pwm_buffers(void) {
-    if (driver_buffers.pwm_buffer_dirty) {
-        is31fl3218_write_pwm_buffer();
+    if (is31_dirty_any(driver_buffers.pwm_buffer_dirty, IS31FL3218_PWM_REGISTER_COUNT)) {
+        // Only the runs of registers changed since the last update are sent
+        is31_dirty_flush(0, driver_buffers.pwm_buffer, driver_buffers.pwm_buffer_dirty, IS31FL3218_PWM_REGISTER_COUNT, is31fl3218_write_pwm_run);
         // Load PWM registers and LED Control register data
         is31fl3218_write_register(IS31FL3218_REG_UPDATE, 0x01);
-
-        driver_buffers.pwm_buffer_dirty = false;
     }
 }
 
@@ -154,3 +157,7 @@ void is31fl3218_update_led_control_registers(void) {
         driver_buffers.led_control_buffer_dirty = false;
     }
 }
+
+uint32_t is31fl3218_get_bytes_written(void) {
+    return bytes_written;
+}
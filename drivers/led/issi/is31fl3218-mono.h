@@ -55,6 +55,10 @@ void is31fl3218_update_pwm_buffers(void);
 
 void is31fl3218_update_led_control_registers(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3218_get_bytes_written(void);
+
 #define OUT1 0x00
 #define OUT2 0x01
 #define OUT3 0x02
@@ -4,6 +4,7 @@
 #include "is31fl3236-mono.h"
 #include "i2c_master.h"
 #include "gpio.h"
+#include "is31_dirty.h"
 
 #define IS31FL3236_PWM_REGISTER_COUNT 36
 #define IS31FL3236_LED_CONTROL_REGISTER_COUNT 36
@@ -35,19 +36,22 @@ const uint8_t i2c_addresses[IS31FL3236_DRIVER_COUNT] = {
 
 typedef struct is31fl3236_driver_t {
     uint8_t pwm_buffer[IS31FL3236_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[IS31_DIRTY_BITMAP_SIZE(IS31FL3236_PWM_REGISTER_COUNT)];
     uint8_t led_control_buffer[IS31FL3236_LED_CONTROL_REGISTER_COUNT];
     bool    led_control_buffer_dirty;
 } PACKED is31fl3236_driver_t;
 
 is31fl3236_driver_t driver_buffers[IS31FL3236_DRIVER_COUNT] = {{
     .pwm_buffer               = {0},
-    .pwm_buffer_dirty         = false,
+    .pwm_buffer_dirty         = {0},
     .led_control_buffer       = {0},
     .led_control_buffer_dirty = false,
 }};
 
+static uint32_t bytes_written = 0;
+
 void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
+    bytes_written += 2;
 #if IS31FL3236_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -57,16 +61,21 @@ void is31fl3236_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
-void is31fl3236_write_pwm_buffer(uint8_t index) {
+static void is31fl3236_write_pwm_run(uint8_t index, uint8_t reg, uint8_t *data, uint16_t length) {
+    bytes_written += 1 + length;
 #if IS31FL3236_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3236_I2C_PERSISTENCE; i++) {
-        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + reg, data, length, IS31FL3236_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
     }
 #else
-    i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM, driver_buffers[index].pwm_buffer, 36, IS31FL3236_I2C_TIMEOUT);
+    i2c_write_register(i2c_addresses[index] << 1, IS31FL3236_REG_PWM + reg, data, length, IS31FL3236_I2C_TIMEOUT);
 #endif
 }
 
+void is31fl3236_write_pwm_buffer(uint8_t index) {
+    is31fl3236_write_pwm_run(index, 0, driver_buffers[index].pwm_buffer, 36);
+}
+
 void is31fl3236_init_drivers(void) {
     i2c_init();
 
@@ -118,12 +127,7 @@ void is31fl3236_set_value(int index, uint8_t value) {
     if (index < IS31FL3236_LED_COUNT) {
         memcpy_P(&led, (&g_is31fl3236_leds[index]), sizeof(led));
 
-        if (driver_buffers[led.driver].pwm_buffer[led.v] == value) {
-            return;
-        }
-
-        driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        is31_dirty_update(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_buffer_dirty, led.v, value);
     }
 }
 
@@ -142,12 +146,11 @@ void is31fl3236_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3236_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3236_write_pwm_buffer(index);
+    if (is31_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3236_PWM_REGISTER_COUNT)) {
+        // Only the runs of registers changed since the last update are sent
+        is31_dirty_flush(index, driver_buffers[index].pwm_buffer, driver_buffers[index].pwm_buffer_dirty, IS31FL3236_PWM_REGISTER_COUNT, is31fl3236_write_pwm_run);
         // Load PWM registers and LED Control register data
         is31fl3236_write_register(index, IS31FL3236_REG_UPDATE, 0x01);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
     }
 }
 
@@ -161,6 +164,10 @@ void is31fl3236_update_led_control_registers(uint8_t index) {
     }
 }
 
+uint32_t is31fl3236_get_bytes_written(void) {
+    return bytes_written;
+}
+
 void is31fl3236_flush(void) {
     for (uint8_t i = 0; i < IS31FL3236_DRIVER_COUNT; i++) {
         is31fl3236_update_pwm_buffers(i);
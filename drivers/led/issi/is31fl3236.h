@@ -62,6 +62,10 @@ void is31fl3236_update_led_control_registers(uint8_t index);
 
 void is31fl3236_flush(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3236_get_bytes_written(void);
+
 #define IS31FL3236_PWM_FREQUENCY_3K_HZ 0b0
 #define IS31FL3236_PWM_FREQUENCY_22K_HZ 0b1
 
@@ -20,6 +20,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "is31_dirty.h"
 
 #define IS31FL3729_PWM_REGISTER_COUNT 143
 #define IS31FL3729_SCALING_REGISTER_COUNT 16
@@ -81,19 +82,22 @@ const uint8_t i2c_addresses[IS31FL3729_DRIVER_COUNT] = {
 // Storing them like this is optimal for I2C transfers to the registers.
 typedef struct is31fl3729_driver_t {
     uint8_t pwm_buffer[IS31FL3729_PWM_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_dirty[IS31_DIRTY_BITMAP_SIZE(IS31FL3729_PWM_REGISTER_COUNT)];
     uint8_t scaling_buffer[IS31FL3729_SCALING_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
 } PACKED is31fl3729_driver_t;
 
 is31fl3729_driver_t driver_buffers[IS31FL3729_DRIVER_COUNT] = {{
     .pwm_buffer           = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_dirty     = {0},
     .scaling_buffer       = {0},
     .scaling_buffer_dirty = false,
 }};
 
+static uint32_t bytes_written = 0;
+
 void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
+    bytes_written += 2;
 #if IS31FL3729_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3729_I2C_PERSISTENCE; i++) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -103,18 +107,23 @@ void is31fl3729_write_register(uint8_t index, uint8_t reg, uint8_t data) {
 #endif
 }
 
+static void is31fl3729_write_pwm_run(uint8_t index, uint8_t reg, uint8_t *data, uint16_t length) {
+    bytes_written += 1 + length;
+#if IS31FL3729_I2C_PERSISTENCE > 0
+    for (uint8_t i = 0; i < IS31FL3729_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + reg, data, length, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
+#else
+    i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + reg, data, length, IS31FL3729_I2C_TIMEOUT);
+#endif
+}
+
 void is31fl3729_write_pwm_buffer(uint8_t index) {
     // Transmit PWM registers in 11 transfers of 13 bytes.
 
     // Iterate over the pwm_buffer contents at 13 byte intervals.
     for (uint8_t i = 0; i <= IS31FL3729_PWM_REGISTER_COUNT; i += 13) {
-#if IS31FL3729_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3729_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, IS31FL3729_REG_PWM + i, driver_buffers[index].pwm_buffer + i, 13, IS31FL3729_I2C_TIMEOUT);
-#endif
+        is31fl3729_write_pwm_run(index, i, driver_buffers[index].pwm_buffer + i, 13);
     }
 }
 
@@ -160,12 +169,7 @@ void is31fl3729_set_value(int index, uint8_t value) {
     if (index >= 0 && index < IS31FL3729_LED_COUNT) {
         memcpy_P(&led, (&g_is31fl3729_leds[index]), sizeof(led));
 
-        if (driver_buffers[led.driver].pwm_buffer[led.v] == value) {
-            return;
-        }
-
-        driver_buffers[led.driver].pwm_buffer[led.v] = value;
-        driver_buffers[led.driver].pwm_buffer_dirty  = true;
+        is31_dirty_update(driver_buffers[led.driver].pwm_buffer, driver_buffers[led.driver].pwm_buffer_dirty, led.v, value);
     }
 }
 
@@ -189,10 +193,9 @@ void is31fl3729_set_scaling_register(uint8_t index, uint8_t value) {
 }
 
 void is31fl3729_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3729_write_pwm_buffer(index);
-
-        driver_buffers[index].pwm_buffer_dirty = false;
+    if (is31_dirty_any(driver_buffers[index].pwm_buffer_dirty, IS31FL3729_PWM_REGISTER_COUNT)) {
+        // Only the runs of registers changed since the last update are sent
+        is31_dirty_flush(index, driver_buffers[index].pwm_buffer, driver_buffers[index].pwm_buffer_dirty, IS31FL3729_PWM_REGISTER_COUNT, is31fl3729_write_pwm_run);
     }
 }
 
@@ -206,6 +209,10 @@ void is31fl3729_update_scaling_registers(uint8_t index) {
     }
 }
 
+uint32_t is31fl3729_get_bytes_written(void) {
+    return bytes_written;
+}
+
 void is31fl3729_flush(void) {
     for (uint8_t i = 0; i < IS31FL3729_DRIVER_COUNT; i++) {
         is31fl3729_update_pwm_buffers(i);
@@ -76,6 +76,10 @@ void is31fl3729_update_scaling_registers(uint8_t index);
 
 void is31fl3729_flush(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3729_get_bytes_written(void);
+
 #define IS31FL3729_SW_PULLDOWN_0_OHM 0b000
 #define IS31FL3729_SW_PULLDOWN_0K5_OHM_SW_OFF 0b001
 #define IS31FL3729_SW_PULLDOWN_1K_OHM_SW_OFF 0b010
@@ -124,6 +124,10 @@ void is31fl3731_update_led_control_registers(uint8_t index);
 
 void is31fl3731_flush(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3731_get_bytes_written(void);
+
 #define C1_1 0x00
 #define C1_2 0x01
 #define C1_3 0x02
@@ -128,6 +128,10 @@ void is31fl3736_update_led_control_registers(uint8_t index);
 
 void is31fl3736_flush(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3736_get_bytes_written(void);
+
 #define IS31FL3736_PDR_0_OHM 0b000   // No pull-down resistor
 #define IS31FL3736_PDR_0K5_OHM 0b001 // 0.5 kOhm resistor
 #define IS31FL3736_PDR_1K_OHM 0b010  // 1 kOhm resistor
@@ -21,6 +21,7 @@
 #include "i2c_master.h"
 #include "gpio.h"
 #include "wait.h"
+#include "is31_dirty.h"
 
 #define IS31FL3741_PWM_0_REGISTER_COUNT 180
 #define IS31FL3741_PWM_1_REGISTER_COUNT 171
@@ -77,7 +78,8 @@ const uint8_t i2c_addresses[IS31FL3741_DRIVER_COUNT] = {
 typedef struct is31fl3741_driver_t {
     uint8_t pwm_buffer_0[IS31FL3741_PWM_0_REGISTER_COUNT];
     uint8_t pwm_buffer_1[IS31FL3741_PWM_1_REGISTER_COUNT];
-    bool    pwm_buffer_dirty;
+    uint8_t pwm_buffer_0_dirty[IS31_DIRTY_BITMAP_SIZE(IS31FL3741_PWM_0_REGISTER_COUNT)];
+    uint8_t pwm_buffer_1_dirty[IS31_DIRTY_BITMAP_SIZE(IS31FL3741_PWM_1_REGISTER_COUNT)];
     uint8_t scaling_buffer_0[IS31FL3741_SCALING_0_REGISTER_COUNT];
     uint8_t scaling_buffer_1[IS31FL3741_SCALING_1_REGISTER_COUNT];
     bool    scaling_buffer_dirty;
@@ -86,13 +88,17 @@ typedef struct is31fl3741_driver_t {
 is31fl3741_driver_t driver_buffers[IS31FL3741_DRIVER_COUNT] = {{
     .pwm_buffer_0         = {0},
     .pwm_buffer_1         = {0},
-    .pwm_buffer_dirty     = false,
+    .pwm_buffer_0_dirty   = {0},
+    .pwm_buffer_1_dirty   = {0},
     .scaling_buffer_0     = {0},
     .scaling_buffer_1     = {0},
     .scaling_buffer_dirty = false,
 }};
 
+static uint32_t bytes_written = 0;
+
 void is31fl3741_write_register(uint8_t index, uint8_t reg, uint8_t data) {
+    bytes_written += 2;
 #if IS31FL3741_I2C_PERSISTENCE > 0
     for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
         if (i2c_write_register(i2c_addresses[index] << 1, reg, &data, 1, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
@@ -107,6 +113,17 @@ void is31fl3741_select_page(uint8_t index, uint8_t page) {
     is31fl3741_write_register(index, IS31FL3741_REG_COMMAND, page);
 }
 
+static void is31fl3741_write_pwm_run(uint8_t index, uint8_t reg, uint8_t *data, uint16_t length) {
+    bytes_written += 1 + length;
+#if IS31FL3741_I2C_PERSISTENCE > 0
+    for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
+        if (i2c_write_register(i2c_addresses[index] << 1, reg, data, length, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
+    }
+#else
+    i2c_write_register(i2c_addresses[index] << 1, reg, data, length, IS31FL3741_I2C_TIMEOUT);
+#endif
+}
+
 void is31fl3741_write_pwm_buffer(uint8_t index) {
     is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
 
@@ -114,13 +131,7 @@ void is31fl3741_write_pwm_buffer(uint8_t index) {
 
     // Iterate over the pwm_buffer_0 contents at 30 byte intervals.
     for (uint8_t i = 0; i < IS31FL3741_PWM_0_REGISTER_COUNT; i += 30) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t j = 0; j < IS31FL3741_I2C_PERSISTENCE; j++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_0 + i, 30, IS31FL3741_I2C_TIMEOUT);
-#endif
+        is31fl3741_write_pwm_run(index, i, driver_buffers[index].pwm_buffer_0 + i, 30);
     }
 
     is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
@@ -129,13 +140,7 @@ void is31fl3741_write_pwm_buffer(uint8_t index) {
 
     // Iterate over the pwm_buffer_1 contents at 19 byte intervals.
     for (uint8_t i = 0; i < IS31FL3741_PWM_1_REGISTER_COUNT; i += 19) {
-#if IS31FL3741_I2C_PERSISTENCE > 0
-        for (uint8_t i = 0; i < IS31FL3741_I2C_PERSISTENCE; i++) {
-            if (i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT) == I2C_STATUS_SUCCESS) break;
-        }
-#else
-        i2c_write_register(i2c_addresses[index] << 1, i, driver_buffers[index].pwm_buffer_1 + i, 19, IS31FL3741_I2C_TIMEOUT);
-#endif
+        is31fl3741_write_pwm_run(index, i, driver_buffers[index].pwm_buffer_1 + i, 19);
     }
 }
 
@@ -195,9 +200,9 @@ uint8_t get_pwm_value(uint8_t driver, uint16_t reg) {
 
 void set_pwm_value(uint8_t driver, uint16_t reg, uint8_t value) {
     if (reg & 0x100) {
-        driver_buffers[driver].pwm_buffer_1[reg & 0xFF] = value;
+        is31_dirty_update(driver_buffers[driver].pwm_buffer_1, driver_buffers[driver].pwm_buffer_1_dirty, reg & 0xFF, value);
     } else {
-        driver_buffers[driver].pwm_buffer_0[reg] = value;
+        is31_dirty_update(driver_buffers[driver].pwm_buffer_0, driver_buffers[driver].pwm_buffer_0_dirty, reg, value);
     }
 }
 
@@ -207,12 +212,7 @@ void is31fl3741_set_value(int index, uint8_t value) {
     if (index >= 0 && index < IS31FL3741_LED_COUNT) {
         memcpy_P(&led, (&g_is31fl3741_leds[index]), sizeof(led));
 
-        if (get_pwm_value(led.driver, led.v) == value) {
-            return;
-        }
-
         set_pwm_value(led.driver, led.v, value);
-        driver_buffers[led.driver].pwm_buffer_dirty = true;
     }
 }
 
@@ -240,16 +240,21 @@ void is31fl3741_set_led_control_register(uint8_t index, bool value) {
 }
 
 void is31fl3741_update_pwm_buffers(uint8_t index) {
-    if (driver_buffers[index].pwm_buffer_dirty) {
-        is31fl3741_write_pwm_buffer(index);
+    // Only the runs of registers changed since the last update are sent
+    if (is31_dirty_any(driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_0);
+
+        is31_dirty_flush(index, driver_buffers[index].pwm_buffer_0, driver_buffers[index].pwm_buffer_0_dirty, IS31FL3741_PWM_0_REGISTER_COUNT, is31fl3741_write_pwm_run);
+    }
+    if (is31_dirty_any(driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT)) {
+        is31fl3741_select_page(index, IS31FL3741_COMMAND_PWM_1);
 
-        driver_buffers[index].pwm_buffer_dirty = false;
+        is31_dirty_flush(index, driver_buffers[index].pwm_buffer_1, driver_buffers[index].pwm_buffer_1_dirty, IS31FL3741_PWM_1_REGISTER_COUNT, is31fl3741_write_pwm_run);
     }
 }
 
 void is31fl3741_set_pwm_buffer(const is31fl3741_led_t *pled, uint8_t value) {
     set_pwm_value(pled->driver, pled->v, value);
-    driver_buffers[pled->driver].pwm_buffer_dirty = true;
 }
 
 void is31fl3741_update_led_control_registers(uint8_t index) {
@@ -275,6 +280,10 @@ void is31fl3741_set_scaling_registers(const is31fl3741_led_t *pled, uint8_t valu
     driver_buffers[pled->driver].scaling_buffer_dirty = true;
 }
 
+uint32_t is31fl3741_get_bytes_written(void) {
+    return bytes_written;
+}
+
 void is31fl3741_flush(void) {
     for (uint8_t i = 0; i < IS31FL3741_DRIVER_COUNT; i++) {
         is31fl3741_update_pwm_buffers(i);
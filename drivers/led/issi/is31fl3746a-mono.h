@@ -98,6 +98,10 @@ void is31fl3746a_update_scaling_registers(uint8_t index);
 
 void is31fl3746a_flush(void);
 
+// Total number of register address and data bytes sent to the drivers, to
+// measure the I2C traffic of a frame.
+uint32_t is31fl3746a_get_bytes_written(void);
+
 #define IS31FL3746A_PDR_0_OHM 0b000          // No pull-down resistor
 #define IS31FL3746A_PDR_0K5_OHM_SW_OFF 0b001 // 0.5 kOhm resistor in SWx off time
 #define IS31FL3746A_PDR_1K_OHM_SW_OFF 0b010  // 1 kOhm resistor in SWx off time
@@ -0,0 +1,160 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#include "is31fl3733.h"
+#include "is31_dirty.h"
+}
+
+#define PWM_REGISTER_COUNT 192
+
+// Unlocking the command register and selecting the PWM page
+#define PAGE_SELECT_TRANSFERS 2
+#define PAGE_SELECT_BYTES (2 * 2)
+
+// Four rows of 16 LEDs, with the red, green and blue channels on consecutive SW lines
+extern "C" const is31fl3733_led_t g_is31fl3733_leds[IS31FL3733_LED_COUNT] = {
+#define LED(i) {0, (i) / 16 * 48 + (i) % 16, (i) / 16 * 48 + (i) % 16 + 16, (i) / 16 * 48 + (i) % 16 + 32}
+#define LED_ROW(i) LED(i), LED(i + 1), LED(i + 2), LED(i + 3), LED(i + 4), LED(i + 5), LED(i + 6), LED(i + 7), LED(i + 8), LED(i + 9), LED(i + 10), LED(i + 11), LED(i + 12), LED(i + 13), LED(i + 14), LED(i + 15)
+    LED_ROW(0),
+    LED_ROW(16),
+    LED_ROW(32),
+    LED_ROW(48),
+#undef LED_ROW
+#undef LED
+};
+
+class IS31FL3733 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Flush whatever a previous test left behind, then start from a known frame
+        is31fl3733_set_color_all(0, 0, 0);
+        is31fl3733_flush();
+        mock_i2c_reset();
+        is31fl3733_init_drivers();
+        mock_transfers = 0;
+        mock_bytes     = 0;
+    }
+
+    // Bytes sent by a flush, including the page selection
+    static uint32_t flush(void) {
+        uint32_t before = mock_bytes;
+        is31fl3733_flush();
+        return mock_bytes - before;
+    }
+
+    static void expect_pwm_page(const uint8_t *expected) {
+        for (uint16_t i = 0; i < PWM_REGISTER_COUNT; i++) {
+            ASSERT_EQ(mock_registers[IS31FL3733_COMMAND_PWM][i], expected[i]) << "register " << i;
+        }
+    }
+
+    static void set_expected(uint8_t *expected, int index, uint8_t red, uint8_t green, uint8_t blue) {
+        expected[g_is31fl3733_leds[index].r] = red;
+        expected[g_is31fl3733_leds[index].g] = green;
+        expected[g_is31fl3733_leds[index].b] = blue;
+    }
+};
+
+TEST_F(IS31FL3733, FullFrameMatchesBuffer) {
+    uint8_t expected[PWM_REGISTER_COUNT] = {0};
+
+    for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        is31fl3733_set_color(i, i + 1, i * 2 + 1, 255 - i);
+        set_expected(expected, i, i + 1, i * 2 + 1, 255 - i);
+    }
+    is31fl3733_flush();
+    expect_pwm_page(expected);
+
+    // Every register changed, so the whole page goes out in runs of the longest write
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + PWM_REGISTER_COUNT / IS31_DIRTY_MAX_RUN);
+    EXPECT_EQ(mock_bytes, PAGE_SELECT_BYTES + PWM_REGISTER_COUNT / IS31_DIRTY_MAX_RUN + PWM_REGISTER_COUNT);
+}
+
+TEST_F(IS31FL3733, SingleLedSendsOnlyItsChannels) {
+    is31fl3733_set_color(20, 1, 2, 3);
+    uint32_t bytes = flush();
+
+    // One register and value for each channel
+    EXPECT_EQ(bytes, PAGE_SELECT_BYTES + 3 * 2);
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + 3);
+    EXPECT_EQ(mock_registers[IS31FL3733_COMMAND_PWM][g_is31fl3733_leds[20].r], 1);
+    EXPECT_EQ(mock_registers[IS31FL3733_COMMAND_PWM][g_is31fl3733_leds[20].g], 2);
+    EXPECT_EQ(mock_registers[IS31FL3733_COMMAND_PWM][g_is31fl3733_leds[20].b], 3);
+}
+
+TEST_F(IS31FL3733, AdjacentLedsAreMerged) {
+    for (int i = 4; i < 8; i++) {
+        is31fl3733_set_color(i, 10, 20, 30);
+    }
+    uint32_t bytes = flush();
+
+    // One run of four registers per channel
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + 3);
+    EXPECT_EQ(bytes, PAGE_SELECT_BYTES + 3 * (1 + 4));
+}
+
+TEST_F(IS31FL3733, SmallGapsAreMerged) {
+    uint8_t expected[PWM_REGISTER_COUNT] = {0};
+
+    is31fl3733_set_color(0, 1, 1, 1);
+    set_expected(expected, 0, 1, 1, 1);
+    is31fl3733_set_color(IS31_DIRTY_MERGE_GAP + 1, 2, 2, 2);
+    set_expected(expected, IS31_DIRTY_MERGE_GAP + 1, 2, 2, 2);
+    // Far enough away to start a new run
+    is31fl3733_set_color(IS31_DIRTY_MERGE_GAP * 2 + 3, 3, 3, 3);
+    set_expected(expected, IS31_DIRTY_MERGE_GAP * 2 + 3, 3, 3, 3);
+    flush();
+
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + 3 * 2);
+    expect_pwm_page(expected);
+}
+
+TEST_F(IS31FL3733, UnchangedFrameSendsNothing) {
+    is31fl3733_set_color(5, 1, 2, 3);
+    flush();
+
+    mock_transfers = 0;
+    EXPECT_EQ(flush(), 0);
+    EXPECT_EQ(mock_transfers, 0);
+}
+
+TEST_F(IS31FL3733, SameColorsSendNothing) {
+    for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        is31fl3733_set_color(i, i, 100, 200);
+    }
+    flush();
+
+    mock_transfers = 0;
+    for (int i = 0; i < IS31FL3733_LED_COUNT; i++) {
+        is31fl3733_set_color(i, i, 100, 200);
+    }
+    EXPECT_EQ(flush(), 0);
+    EXPECT_EQ(mock_transfers, 0);
+}
+
+TEST_F(IS31FL3733, OnlyChangedChannelsAreSent) {
+    is31fl3733_set_color(20, 1, 2, 3);
+    flush();
+
+    mock_transfers = 0;
+    is31fl3733_set_color(20, 1, 5, 3);
+    EXPECT_EQ(flush(), PAGE_SELECT_BYTES + 2);
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + 1);
+    EXPECT_EQ(mock_registers[IS31FL3733_COMMAND_PWM][g_is31fl3733_leds[20].g], 5);
+}
+
+TEST_F(IS31FL3733, BytesWrittenMatchesBus) {
+    uint32_t driver_before = is31fl3733_get_bytes_written();
+    uint32_t bus_before    = mock_bytes;
+
+    is31fl3733_set_color_all(9, 8, 7);
+    is31fl3733_flush();
+    is31fl3733_set_color(63, 0, 0, 0);
+    is31fl3733_flush();
+
+    EXPECT_EQ(is31fl3733_get_bytes_written() - driver_before, mock_bytes - bus_before);
+}
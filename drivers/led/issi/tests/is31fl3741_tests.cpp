@@ -0,0 +1,81 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#include "is31fl3741.h"
+#include "is31_dirty.h"
+}
+
+// Unlocking the command register and selecting a PWM page
+#define PAGE_SELECT_TRANSFERS 2
+#define PAGE_SELECT_BYTES (2 * 2)
+
+// Eight LEDs on each of the two PWM pages, with the red, green and blue channels next to each other
+extern "C" const is31fl3741_led_t g_is31fl3741_leds[IS31FL3741_LED_COUNT] = {
+#define LED(i) {0, (i) / 8 * 0x100 + (i) % 8 * 3, (i) / 8 * 0x100 + (i) % 8 * 3 + 1, (i) / 8 * 0x100 + (i) % 8 * 3 + 2}
+    LED(0), LED(1), LED(2),  LED(3),  LED(4),  LED(5),  LED(6),  LED(7),
+    LED(8), LED(9), LED(10), LED(11), LED(12), LED(13), LED(14), LED(15),
+#undef LED
+};
+
+class IS31FL3741 : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        // Flush whatever a previous test left behind, then start from a known frame
+        is31fl3741_set_color_all(0, 0, 0);
+        is31fl3741_flush();
+        mock_i2c_reset();
+        is31fl3741_init_drivers();
+        mock_transfers = 0;
+        mock_bytes     = 0;
+    }
+
+    // Bytes sent by a flush, including the page selections
+    static uint32_t flush(void) {
+        uint32_t before = mock_bytes;
+        is31fl3741_flush();
+        return mock_bytes - before;
+    }
+
+    static uint8_t pwm_register(uint16_t reg) {
+        return mock_registers[reg & 0x100 ? IS31FL3741_COMMAND_PWM_1 : IS31FL3741_COMMAND_PWM_0][reg & 0xFF];
+    }
+};
+
+TEST_F(IS31FL3741, FullFrameReachesBothPages) {
+    for (int i = 0; i < IS31FL3741_LED_COUNT; i++) {
+        is31fl3741_set_color(i, i + 1, i + 2, i + 3);
+    }
+    flush();
+
+    for (int i = 0; i < IS31FL3741_LED_COUNT; i++) {
+        EXPECT_EQ(pwm_register(g_is31fl3741_leds[i].r), i + 1) << "LED " << i;
+        EXPECT_EQ(pwm_register(g_is31fl3741_leds[i].g), i + 2) << "LED " << i;
+        EXPECT_EQ(pwm_register(g_is31fl3741_leds[i].b), i + 3) << "LED " << i;
+    }
+}
+
+TEST_F(IS31FL3741, OnlyTheChangedPageIsSelected) {
+    is31fl3741_set_color(12, 1, 2, 3);
+    uint32_t bytes = flush();
+
+    // One run of the three channels on the second page
+    EXPECT_EQ(mock_transfers, PAGE_SELECT_TRANSFERS + 1);
+    EXPECT_EQ(bytes, PAGE_SELECT_BYTES + 1 + 3);
+    EXPECT_EQ(mock_page, IS31FL3741_COMMAND_PWM_1);
+    EXPECT_EQ(pwm_register(g_is31fl3741_leds[12].g), 2);
+}
+
+TEST_F(IS31FL3741, UnchangedFrameSendsNothing) {
+    is31fl3741_set_color(3, 1, 2, 3);
+    is31fl3741_set_color(11, 1, 2, 3);
+    flush();
+
+    mock_transfers = 0;
+    is31fl3741_set_color(3, 1, 2, 3);
+    EXPECT_EQ(flush(), 0);
+    EXPECT_EQ(mock_transfers, 0);
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock.h"
+
+#define MOCK_REG_COMMAND 0xFD
+
+uint8_t  mock_registers[MOCK_PAGE_COUNT][256];
+uint8_t  mock_page;
+uint32_t mock_transfers;
+uint32_t mock_bytes;
+
+void mock_i2c_reset(void) {
+    memset(mock_registers, 0, sizeof(mock_registers));
+    mock_page      = 0;
+    mock_transfers = 0;
+    mock_bytes     = 0;
+}
+
+void i2c_init(void) {}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    mock_transfers++;
+    mock_bytes += 1 + length;
+
+    if (regaddr == MOCK_REG_COMMAND && length == 1) {
+        mock_page = data[0] % MOCK_PAGE_COUNT;
+        return I2C_STATUS_SUCCESS;
+    }
+    // The register address auto-increments within a page
+    for (uint16_t i = 0; i < length && regaddr + i < 256; i++) {
+        mock_registers[mock_page][regaddr + i] = data[i];
+    }
+    return I2C_STATUS_SUCCESS;
+}
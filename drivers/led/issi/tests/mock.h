@@ -0,0 +1,16 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "i2c_master.h"
+
+#define MOCK_PAGE_COUNT 5
+
+// Paged register model of a single ISSI driver, selected through the command register
+extern uint8_t  mock_registers[MOCK_PAGE_COUNT][256];
+extern uint8_t  mock_page;
+extern uint32_t mock_transfers;
+extern uint32_t mock_bytes;
+
+void mock_i2c_reset(void);
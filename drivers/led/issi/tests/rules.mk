@@ -0,0 +1,17 @@
+is31fl3733_DEFS := -DIS31FL3733_I2C_ADDRESS_1=0x50 -DIS31FL3733_LED_COUNT=64
+is31fl3733_INC := $(DRIVER_PATH)/led/issi/tests $(DRIVER_PATH)/led/issi
+
+is31fl3733_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/led/issi/tests/mock.c \
+	$(DRIVER_PATH)/led/issi/tests/is31fl3733_tests.cpp \
+	$(DRIVER_PATH)/led/issi/is31fl3733.c
+
+is31fl3741_DEFS := -DIS31FL3741_I2C_ADDRESS_1=0x30 -DIS31FL3741_LED_COUNT=16
+is31fl3741_INC := $(is31fl3733_INC)
+
+is31fl3741_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/led/issi/tests/mock.c \
+	$(DRIVER_PATH)/led/issi/tests/is31fl3741_tests.cpp \
+	$(DRIVER_PATH)/led/issi/is31fl3741.c
@@ -446,16 +446,109 @@ static void rotate_90(const uint8_t *src, uint8_t *dest) {
     }
 }
 
-void oled_render_dirty(bool all) {
-    // Do we have work to do?
-    oled_dirty &= OLED_ALL_BLOCKS_MASK;
-    if (!oled_dirty || !oled_initialized || oled_scrolling) {
-        return;
+#ifdef OLED_UPDATE_BYTE_LIMIT
+#    if defined(OLED_TRANSPORT_SPI)
+// The control byte of I2C is a pin on SPI
+#        define OLED_CONTROL_BYTES 0
+#    else
+#        define OLED_CONTROL_BYTES 1
+#    endif
+
+static oled_render_stats_t oled_render_stats;
+static oled_render_stats_t oled_render_frame;
+
+static bool oled_render_cmd(const uint8_t *data, uint16_t size) {
+    oled_render_frame.bytes += size - 1 + OLED_CONTROL_BYTES;
+    oled_render_frame.transactions++;
+    return oled_send_cmd(data, size);
+}
+
+static bool oled_render_data(const uint8_t *data, uint16_t size) {
+    oled_render_frame.bytes += size + OLED_CONTROL_BYTES;
+    oled_render_frame.transactions++;
+    return oled_send_data(data, size);
+}
+
+const oled_render_stats_t *oled_get_render_stats(void) {
+    return &oled_render_stats;
+}
+
+// Sends length bytes of the buffer from start with as few addressing commands as the controller allows
+static bool oled_render_run(uint16_t start, uint16_t length) {
+    while (length) {
+        uint8_t  page   = start / OLED_DISPLAY_WIDTH;
+        uint8_t  column = start % OLED_DISPLAY_WIDTH;
+        uint16_t count  = OLED_DISPLAY_WIDTH - column;
+#    if OLED_IC_HAS_HORIZONTAL_MODE
+        // From the first column, the controller carries on with the following pages by itself
+        if (column == 0 || count > length) {
+            count = length;
+        }
+        uint8_t display_start[] = {I2C_CMD, COLUMN_ADDR, column + OLED_COLUMN_OFFSET, OLED_DISPLAY_WIDTH - 1 + OLED_COLUMN_OFFSET, PAGE_ADDR, page, (start + count - 1) / OLED_DISPLAY_WIDTH};
+#    else
+        // Page Addressing Mode stops at the end of every page
+        if (count > length) {
+            count = length;
+        }
+        uint8_t display_start[] = {I2C_CMD, PAM_PAGE_ADDR | page, PAM_SETCOLUMN_LSB | ((OLED_COLUMN_OFFSET + column) & 0x0f), PAM_SETCOLUMN_MSB | ((OLED_COLUMN_OFFSET + column) >> 4 & 0x0f)};
+#    endif
+        if (!oled_render_cmd(display_start, ARRAY_SIZE(display_start))) {
+            print("oled_render offset command failed\n");
+            return false;
+        }
+        if (!oled_render_data(&oled_buffer[start], count)) {
+            print("oled_render data failed\n");
+            return false;
+        }
+        start += count;
+        length -= count;
     }
+    return true;
+}
 
-    // Turn on display if it is off
-    oled_on();
+// Sends each run of dirty blocks at once, within OLED_UPDATE_BYTE_LIMIT bytes unless rendering all of them
+static void oled_render_runs(bool all) {
+    uint16_t budget       = OLED_UPDATE_BYTE_LIMIT;
+    uint8_t  update_start = 0;
+    while (oled_dirty) {
+        while (!(oled_dirty & ((OLED_BLOCK_TYPE)1 << update_start))) {
+            ++update_start;
+        }
+        uint8_t update_end = update_start + 1;
+        while (update_end < OLED_BLOCK_COUNT && (oled_dirty & ((OLED_BLOCK_TYPE)1 << update_end))) {
+            ++update_end;
+        }
+
+        if (!all) {
+            // At least one block is sent, however small the limit
+            uint8_t blocks = budget / OLED_BLOCK_SIZE;
+            if (blocks == 0) {
+                if (budget < OLED_UPDATE_BYTE_LIMIT) {
+                    return;
+                }
+                blocks = 1;
+            }
+            if (update_end - update_start > blocks) {
+                update_end = update_start + blocks;
+            }
+            budget = budget > (update_end - update_start) * OLED_BLOCK_SIZE ? budget - (update_end - update_start) * OLED_BLOCK_SIZE : 0;
+        }
 
+        if (!oled_render_run(OLED_BLOCK_SIZE * update_start, OLED_BLOCK_SIZE * (update_end - update_start))) {
+            return;
+        }
+        for (; update_start < update_end; ++update_start) {
+            oled_dirty &= ~((OLED_BLOCK_TYPE)1 << update_start);
+        }
+    }
+}
+#else
+#    define oled_render_cmd oled_send_cmd
+#    define oled_render_data oled_send_data
+#endif
+
+// Sends each dirty block on its own, up to OLED_UPDATE_PROCESS_LIMIT of them unless rendering all of them
+static void oled_render_blocks(bool all) {
     uint8_t update_start  = 0;
     uint8_t num_processed = 0;
     while (oled_dirty && (num_processed++ < OLED_UPDATE_PROCESS_LIMIT || all)) { // render all dirty blocks (up to the configured limit)
@@ -477,14 +570,14 @@ void oled_render_dirty(bool all) {
         }
 
         // Send column & page position
-        if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+        if (!oled_render_cmd(display_start, ARRAY_SIZE(display_start))) {
             print("oled_render offset command failed\n");
             return;
         }
 
         if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
             // Send render data chunk as is
-            if (!oled_send_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
+            if (!oled_render_data(&oled_buffer[OLED_BLOCK_SIZE * update_start], OLED_BLOCK_SIZE)) {
                 print("oled_render data failed\n");
                 return;
             }
@@ -501,7 +594,7 @@ void oled_render_dirty(bool all) {
 
 #if OLED_IC_HAS_HORIZONTAL_MODE
             // Send render data chunk after rotating
-            if (!oled_send_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
+            if (!oled_render_data(&temp_buffer[0], OLED_BLOCK_SIZE)) {
                 print("oled_render90 data failed\n");
                 return;
             }
@@ -513,13 +606,13 @@ void oled_render_dirty(bool all) {
                 // Send column & page position for all pages except the first one
                 if (i > 0) {
                     display_start[1]++;
-                    if (!oled_send_cmd(display_start, ARRAY_SIZE(display_start))) {
+                    if (!oled_render_cmd(display_start, ARRAY_SIZE(display_start))) {
                         print("oled_render offset command failed\n");
                         return;
                     }
                 }
                 // Send data for the page
-                if (!oled_send_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
+                if (!oled_render_data(&temp_buffer[columns_in_block * i], columns_in_block)) {
                     print("oled_render90 data failed\n");
                     return;
                 }
@@ -532,6 +625,33 @@ void oled_render_dirty(bool all) {
     }
 }
 
+void oled_render_dirty(bool all) {
+    // Do we have work to do?
+    oled_dirty &= OLED_ALL_BLOCKS_MASK;
+    if (!oled_dirty || !oled_initialized || oled_scrolling) {
+        return;
+    }
+
+    // Turn on display if it is off
+    oled_on();
+
+#ifdef OLED_UPDATE_BYTE_LIMIT
+    oled_render_frame.renders++;
+    // Rotated blocks are not contiguous on the display, so they are still sent one by one
+    if (!HAS_FLAGS(oled_rotation, OLED_ROTATION_90)) {
+        oled_render_runs(all);
+    } else {
+        oled_render_blocks(all);
+    }
+    if (!oled_dirty) {
+        oled_render_stats = oled_render_frame;
+        memset(&oled_render_frame, 0, sizeof(oled_render_frame));
+    }
+#else
+    oled_render_blocks(all);
+#endif
+}
+
 void oled_set_cursor(uint8_t col, uint8_t line) {
     uint16_t index = line * oled_rotation_width + col * OLED_FONT_WIDTH;
 
@@ -968,6 +1088,36 @@ void oled_task(void) {
 #endif
 }
 
+static inline uint32_t oled_deadline_remaining(uint32_t deadline) {
+    uint32_t now = timer_read32();
+    return timer_expired32(now, deadline) ? 0 : deadline - now;
+}
+
+uint32_t oled_time_until_next(void) {
+    if (!oled_initialized) {
+        return TIMER_NO_DEADLINE;
+    }
+
+#if OLED_UPDATE_INTERVAL > 0
+    uint32_t next = timer_remaining(oled_update_timeout, OLED_UPDATE_INTERVAL);
+#else
+    // oled_task_user is called on every pass
+    uint32_t next = 0;
+#endif
+
+#if OLED_TIMEOUT > 0
+    if (oled_active && oled_deadline_remaining(oled_timeout) < next) {
+        next = oled_deadline_remaining(oled_timeout);
+    }
+#endif
+#if OLED_SCROLL_TIMEOUT > 0
+    if (!oled_scrolling && oled_deadline_remaining(oled_scroll_timeout) < next) {
+        next = oled_deadline_remaining(oled_scroll_timeout);
+    }
+#endif
+    return next;
+}
+
 __attribute__((weak)) bool oled_task_kb(void) {
     return oled_task_user();
 }
@@ -321,6 +321,17 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #    define OLED_UPDATE_PROCESS_LIMIT 1
 #endif
 
+// When defined, adjacent dirty blocks are sent together, up to this many bytes of the buffer per render
+// #define OLED_UPDATE_BYTE_LIMIT 256
+
+#ifdef OLED_UPDATE_BYTE_LIMIT
+typedef struct {
+    uint16_t bytes;        // Sent to the display, including the commands
+    uint16_t transactions; // Commands and data sent separately
+    uint16_t renders;      // Calls to oled_render_dirty that sent something
+} oled_render_stats_t;
+#endif
+
 typedef struct __attribute__((__packed__)) {
     uint8_t *current_element;
     uint16_t remaining_element_count;
@@ -360,6 +371,11 @@ void oled_clear(void);
 // all.
 void oled_render_dirty(bool all);
 
+#ifdef OLED_UPDATE_BYTE_LIMIT
+// Returns what it took to send the last frame, from the first dirty block until none were left
+const oled_render_stats_t *oled_get_render_stats(void);
+#endif
+
 // Moves cursor to character position indicated by column and line, wraps if out of bounds
 // Max column denoted by 'oled_max_chars()' and max lines by 'oled_max_lines()' functions
 void oled_set_cursor(uint8_t col, uint8_t line);
@@ -446,6 +462,9 @@ uint8_t oled_get_brightness(void);
 // Basically it's oled_render, but with timeout management and oled_task_user calling!
 void oled_task(void);
 
+// Milliseconds until oled_task next calls oled_task_user or times out, or TIMER_NO_DEADLINE if it never will
+uint32_t oled_time_until_next(void);
+
 // Called at the start of oled_task, weak function overridable by the user
 bool oled_task_kb(void);
 bool oled_task_user(void);
@@ -0,0 +1,121 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "mock.h"
+
+#define MOCK_CONTROL_CMD 0x00
+#define MOCK_CONTROL_DATA 0x40
+
+#define MOCK_HORIZONTAL_MODE 0x00
+#define MOCK_PAGE_MODE 0x02
+
+uint8_t  mock_ram[MOCK_PAGE_COUNT][MOCK_COLUMN_COUNT];
+uint32_t mock_transfers;
+uint32_t mock_bytes;
+
+static uint8_t mode;
+static uint8_t column, column_start, column_end;
+static uint8_t page, page_start, page_end;
+
+void mock_i2c_reset(void) {
+    memset(mock_ram, 0, sizeof(mock_ram));
+    mock_transfers = 0;
+    mock_bytes     = 0;
+    mode           = MOCK_PAGE_MODE;
+    column = column_start = 0;
+    column_end            = 127;
+    page = page_start = 0;
+    page_end          = 7;
+}
+
+void i2c_init(void) {}
+
+// Number of arguments following each command, for the commands that have any
+static uint8_t argument_count(uint8_t command) {
+    switch (command) {
+        case 0x26: // SCROLL_RIGHT
+        case 0x27: // SCROLL_LEFT
+            return 6;
+        case 0x29: // SCROLL_RIGHT_UP
+        case 0x2A: // SCROLL_LEFT_UP
+            return 5;
+        case 0x21: // COLUMN_ADDR
+        case 0x22: // PAGE_ADDR
+            return 2;
+        case 0x20: // MEMORY_MODE
+        case 0x23: // FADE_BLINK
+        case 0x81: // CONTRAST
+        case 0x8D: // CHARGE_PUMP
+        case 0xA8: // MULTIPLEX_RATIO
+        case 0xD3: // DISPLAY_OFFSET
+        case 0xD5: // DISPLAY_CLOCK
+        case 0xD9: // PRE_CHARGE_PERIOD
+        case 0xDA: // COM_PINS
+        case 0xDB: // VCOM_DETECT
+        case 0xDC: // SH1107_DISPLAY_START_LINE
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+i2c_status_t i2c_transmit(uint8_t address, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    mock_transfers++;
+    mock_bytes += length;
+    if (length == 0 || data[0] != MOCK_CONTROL_CMD) {
+        return I2C_STATUS_ERROR;
+    }
+
+    for (uint16_t i = 1; i < length; i += 1 + argument_count(data[i])) {
+        const uint8_t* args = &data[i + 1];
+        if (i + argument_count(data[i]) >= length) {
+            return I2C_STATUS_ERROR;
+        }
+        switch (data[i]) {
+            case 0x20:
+                mode = args[0];
+                break;
+            case 0x21:
+                column = column_start = args[0];
+                column_end            = args[1];
+                break;
+            case 0x22:
+                page = page_start = args[0];
+                page_end          = args[1];
+                break;
+            default:
+                if (data[i] <= 0x0F) {
+                    column = (column & 0xF0) | data[i];
+                } else if (data[i] <= 0x1F) {
+                    column = (column & 0x0F) | (data[i] & 0x0F) << 4;
+                } else if (data[i] >= 0xB0 && data[i] <= 0xBF) {
+                    page = data[i] & 0x0F;
+                }
+                break;
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
+
+i2c_status_t i2c_write_register(uint8_t devaddr, uint8_t regaddr, const uint8_t* data, uint16_t length, uint16_t timeout) {
+    mock_transfers++;
+    mock_bytes += 1 + length;
+    if (regaddr != MOCK_CONTROL_DATA) {
+        return I2C_STATUS_ERROR;
+    }
+
+    for (uint16_t i = 0; i < length; i++) {
+        mock_ram[page % MOCK_PAGE_COUNT][column] = data[i];
+        if (mode != MOCK_HORIZONTAL_MODE) {
+            // Page Addressing Mode stays on the same page
+            column++;
+        } else if (column == column_end) {
+            column = column_start;
+            page   = page == page_end ? page_start : page + 1;
+        } else {
+            column++;
+        }
+    }
+    return I2C_STATUS_SUCCESS;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "i2c_master.h"
+
+#define MOCK_PAGE_COUNT 16
+#define MOCK_COLUMN_COUNT 256
+
+// Display memory of an SSD1306 or SH1106, addressed through the commands the driver sends
+extern uint8_t  mock_ram[MOCK_PAGE_COUNT][MOCK_COLUMN_COUNT];
+extern uint32_t mock_transfers;
+extern uint32_t mock_bytes;
+
+void mock_i2c_reset(void);
@@ -0,0 +1,148 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <random>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#include "oled_driver.h"
+
+extern uint8_t         oled_buffer[OLED_MATRIX_SIZE];
+extern OLED_BLOCK_TYPE oled_dirty;
+}
+
+#define PAGE_COUNT (OLED_DISPLAY_HEIGHT / 8)
+#define BLOCK_COUNT (OLED_MATRIX_SIZE / OLED_BLOCK_SIZE)
+#define ALL_BLOCKS ((OLED_BLOCK_TYPE)((1ULL << BLOCK_COUNT) - 1))
+
+#if OLED_IC == OLED_IC_SSD1306
+// Column and page windows
+#    define ADDRESSING_BYTES 6
+#else
+// Page and both halves of the column
+#    define ADDRESSING_BYTES 3
+#endif
+
+class OledDriver : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        mock_i2c_reset();
+        ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+        render_all();
+    }
+
+    // Renders until nothing is left, returning the number of renders it took
+    static int render_all(void) {
+        int renders = 0;
+        while (oled_dirty) {
+            oled_render();
+            renders++;
+        }
+        return renders;
+    }
+
+    static void expect_display_matches_buffer(void) {
+        for (uint16_t i = 0; i < OLED_MATRIX_SIZE; i++) {
+            ASSERT_EQ(mock_ram[i / OLED_DISPLAY_WIDTH][i % OLED_DISPLAY_WIDTH + OLED_COLUMN_OFFSET], oled_buffer[i]) << "byte " << i;
+        }
+    }
+
+    static void fill_blocks(uint8_t first, uint8_t count, uint8_t seed) {
+        std::mt19937 random(seed);
+        for (uint16_t i = first * OLED_BLOCK_SIZE; i < (first + count) * OLED_BLOCK_SIZE; i++) {
+            oled_write_raw_byte(random(), i);
+        }
+    }
+
+    // Transactions and bytes of a run of blocks, one addressing command and data write for each part
+    static void expect_stats(uint16_t parts, uint16_t data_bytes) {
+        const oled_render_stats_t* stats = oled_get_render_stats();
+        EXPECT_EQ(stats->transactions, parts * 2);
+        EXPECT_EQ(stats->bytes, parts * (ADDRESSING_BYTES + 1 + 1) + data_bytes);
+    }
+};
+
+TEST_F(OledDriver, FullRedrawMatchesBuffer) {
+    fill_blocks(0, BLOCK_COUNT, 1);
+    EXPECT_EQ(render_all(), OLED_MATRIX_SIZE / OLED_UPDATE_BYTE_LIMIT);
+    expect_display_matches_buffer();
+
+    const oled_render_stats_t* stats = oled_get_render_stats();
+    EXPECT_EQ(stats->renders, OLED_MATRIX_SIZE / OLED_UPDATE_BYTE_LIMIT);
+#if OLED_IC == OLED_IC_SSD1306
+    // The controller moves on to the following pages by itself
+    expect_stats(OLED_MATRIX_SIZE / OLED_UPDATE_BYTE_LIMIT, OLED_MATRIX_SIZE);
+#else
+    expect_stats(PAGE_COUNT, OLED_MATRIX_SIZE);
+#endif
+    std::printf("oled: full redraw in %u renders, %u transactions, %u bytes, one block per render would take %u renders and %u transactions\n", stats->renders, stats->transactions, stats->bytes, BLOCK_COUNT, BLOCK_COUNT * 2);
+}
+
+TEST_F(OledDriver, StatsMatchBus) {
+    fill_blocks(3, 4, 2);
+    uint32_t before = mock_bytes;
+    render_all();
+    EXPECT_EQ(oled_get_render_stats()->bytes, mock_bytes - before);
+}
+
+TEST_F(OledDriver, AdjacentBlocksAreMerged) {
+    // The second page of the display
+    uint8_t first = OLED_DISPLAY_WIDTH / OLED_BLOCK_SIZE;
+    fill_blocks(first, OLED_DISPLAY_WIDTH / OLED_BLOCK_SIZE, 3);
+    EXPECT_EQ(render_all(), 1);
+    expect_display_matches_buffer();
+    expect_stats(1, OLED_DISPLAY_WIDTH);
+}
+
+TEST_F(OledDriver, RunsAreSplitAtPages) {
+    // From the middle of the first page into the third one
+    fill_blocks(1, OLED_DISPLAY_WIDTH * 2 / OLED_BLOCK_SIZE, 4);
+    EXPECT_EQ(render_all(), 1);
+    expect_display_matches_buffer();
+#if OLED_IC == OLED_IC_SSD1306
+    // The rest of the first page, then the remaining pages at once
+    expect_stats(2, OLED_DISPLAY_WIDTH * 2);
+#else
+    expect_stats(3, OLED_DISPLAY_WIDTH * 2);
+#endif
+}
+
+TEST_F(OledDriver, SeparateRunsShareTheLimit) {
+    fill_blocks(0, 1, 5);
+    fill_blocks(4, 1, 6);
+    fill_blocks(BLOCK_COUNT - 2, 2, 7);
+    EXPECT_EQ(render_all(), 1);
+    expect_display_matches_buffer();
+    expect_stats(3, OLED_BLOCK_SIZE * 4);
+}
+
+TEST_F(OledDriver, LimitSpreadsLargeUpdates) {
+    fill_blocks(0, BLOCK_COUNT, 8);
+    oled_render();
+    EXPECT_EQ(oled_dirty, (OLED_BLOCK_TYPE)(ALL_BLOCKS & ~((1ULL << (OLED_UPDATE_BYTE_LIMIT / OLED_BLOCK_SIZE)) - 1)));
+    render_all();
+    expect_display_matches_buffer();
+}
+
+TEST_F(OledDriver, RenderAllIgnoresLimit) {
+    fill_blocks(0, BLOCK_COUNT, 9);
+    oled_render_dirty(true);
+    EXPECT_EQ(oled_dirty, 0);
+    expect_display_matches_buffer();
+    EXPECT_EQ(oled_get_render_stats()->renders, 1);
+}
+
+TEST_F(OledDriver, UnchangedDisplaySendsNothing) {
+    uint32_t transfers = mock_transfers;
+    oled_render();
+    EXPECT_EQ(mock_transfers, transfers);
+}
+
+TEST_F(OledDriver, RotatedBlocksAreSentOneByOne) {
+    ASSERT_TRUE(oled_init(OLED_ROTATION_90));
+    EXPECT_EQ(render_all(), BLOCK_COUNT / OLED_UPDATE_PROCESS_LIMIT);
+    EXPECT_GE(oled_get_render_stats()->transactions, BLOCK_COUNT * 2);
+    ASSERT_TRUE(oled_init(OLED_ROTATION_0));
+}
@@ -0,0 +1,12 @@
+oled_ssd1306_DEFS := -DOLED_TRANSPORT_I2C -DOLED_DISPLAY_128X64 -DOLED_UPDATE_BYTE_LIMIT=512
+oled_ssd1306_INC := $(DRIVER_PATH)/oled/tests $(DRIVER_PATH)/oled
+
+oled_ssd1306_SRC := \
+	platforms/test/timer.c \
+	$(DRIVER_PATH)/oled/tests/mock.c \
+	$(DRIVER_PATH)/oled/tests/oled_driver_tests.cpp \
+	$(DRIVER_PATH)/oled/oled_driver.c
+
+oled_sh1106_DEFS := $(oled_ssd1306_DEFS) -DOLED_IC=OLED_IC_SH1106 -DOLED_COLUMN_OFFSET=2
+oled_sh1106_INC := $(oled_ssd1306_INC)
+oled_sh1106_SRC := $(oled_ssd1306_SRC)
@@ -0,0 +1 @@
+TEST_LIST += oled_ssd1306 oled_sh1106
@@ -28,6 +28,13 @@ void soft_serial_target_init(void);
 
 bool soft_serial_transaction(int sstd_index);
 
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+// Whether the target asked for attention since the last call, initiator side
+bool soft_serial_attention(void);
+// Sends an attention request while something is pending, target side
+void soft_serial_signal(bool pending);
+#endif
+
 #ifdef SERIAL_DEBUG
 #    include <debug.h>
 #    include <print.h>
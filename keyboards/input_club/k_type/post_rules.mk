@@ -1,5 +1,6 @@
 ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
 	# Additional files for RGB lighting
 	SRC += k_type-rgbdriver.c is31fl3733-dual.c
+	COMMON_VPATH += $(DRIVER_PATH)/led/issi
 	QUANTUM_LIB_SRC += i2c_master.c
 endif
@@ -8,6 +8,11 @@ void set_time(uint64_t tset) {
 
 void timer_init(void) {
     timer_clear();
+
+    // Start the DWT cycle counter used by timer_read_cycles()
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CYCCNT = 0;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 }
 
 uint16_t timer_read(void) {
@@ -30,6 +35,10 @@ uint32_t timer_elapsed32(uint32_t tlast) {
     return TIMER_DIFF_32(timer_read32(), tlast);
 }
 
+uint32_t timer_read_cycles(void) {
+    return DWT->CYCCNT;
+}
+
 void timer_clear(void) {
     set_time(0);
 }
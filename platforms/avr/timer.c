@@ -134,6 +134,34 @@ inline uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(t, last);
 }
 
+#if defined(__AVR_ATmega32A__)
+#    define TIMER_COMPARE_PENDING() (TIFR & _BV(OCF0))
+#elif defined(__AVR_ATtiny85__)
+#    define TIMER_COMPARE_PENDING() (TIFR & _BV(OCF0A))
+#else
+#    define TIMER_COMPARE_PENDING() (TIFR0 & _BV(OCF0A))
+#endif
+
+/** \brief timer read cycles
+ *
+ * Combines the millisecond count with the raw timer0 count, so one unit is one timer0 tick.
+ */
+uint32_t timer_read_cycles(void) {
+    uint32_t t;
+    uint8_t  raw;
+
+    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
+        t   = timer_count;
+        raw = TIMER_RAW;
+        // Timer0 already wrapped, but the compare match interrupt has not counted it yet
+        if (TIMER_COMPARE_PENDING() && raw < TIMER_RAW_TOP) {
+            t++;
+        }
+    }
+
+    return t * (TIMER_RAW_TOP + 1) + raw;
+}
+
 // excecuted once per 1ms.(excess for just timer count?)
 #ifndef __AVR_ATmega32A__
 #    define TIMER_INTERRUPT_VECTOR TIMER0_COMPA_vect
@@ -0,0 +1,155 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "audio.h"
+#include "audio_mixer.h"
+#include "gpio.h"
+#include <string.h>
+
+/*
+  Audio Driver: DAC mixer
+
+  plays the blocks rendered ahead of time by the wavetable mixer in quantum/audio/audio_mixer.c,
+  which mixes AUDIO_MIXER_VOICES tones from the main loop; the DMA callback only copies samples
+*/
+
+#if !defined(AUDIO_PIN)
+#    error "Audio feature enabled, but no suitable pin selected as AUDIO_PIN - see docs/feature_audio under 'ARM (DAC mixer)' for available options."
+#endif
+#if defined(AUDIO_PIN_ALT) && !defined(AUDIO_PIN_ALT_AS_NEGATIVE)
+#    pragma message "Audio feature: AUDIO_PIN_ALT set, but not AUDIO_PIN_ALT_AS_NEGATIVE - pin will be left unused; audio might still work though."
+#endif
+
+#if !defined(AUDIO_PIN_ALT)
+// no ALT pin defined is valid, but the c-ifs below need some value set
+#    define AUDIO_PIN_ALT PAL_NOLINE
+#endif
+
+_Static_assert(AUDIO_MIXER_BLOCK_SIZE == AUDIO_DAC_BUFFER_SIZE / 2, "AUDIO_MIXER_BLOCK_SIZE must be half of AUDIO_DAC_BUFFER_SIZE");
+
+/* The gpt timer runs with 3*AUDIO_DAC_SAMPLE_RATE and a conversion is triggered every second
+ * tick, see the DAC_TRG note below, so samples are consumed at one and a half times the rate.
+ */
+#define AUDIO_DAC_MIXER_OUTPUT_RATE (AUDIO_DAC_SAMPLE_RATE * 3 / 2)
+
+static dacsample_t dac_buffer[AUDIO_DAC_BUFFER_SIZE];
+
+typedef enum {
+    OUTPUT_RUN_NORMALLY,
+    // the mixer fades the voices out by itself, wait until it has nothing left to play
+    OUTPUT_SHOULD_STOP,
+    OUTPUT_OFF,
+    OUTPUT_OFF_1,
+    OUTPUT_OFF_2, // trailing off: giving the DAC two more conversion cycles until the AUDIO_DAC_OFF_VALUE reaches the output, then turn the timer off, which leaves the output at that level
+} output_states_t;
+static output_states_t state = OUTPUT_OFF_2;
+
+/**
+ * DAC streaming callback, copying the next rendered block to the half of the buffer that was just played.
+ *
+ * Note: chibios calls this CB twice: during the 'half buffer event', and the 'full buffer event'.
+ */
+static void dac_end(DACDriver *dacp) {
+    dacsample_t *sample_p = (dacp)->samples;
+
+    // work on the other half of the buffer
+    if (dacIsBufferComplete(dacp)) {
+        sample_p += AUDIO_DAC_BUFFER_SIZE / 2; // 'half_index'
+    }
+
+    const audio_mixer_sample_t *block = OUTPUT_OFF <= state ? NULL : audio_mixer_read_block();
+    if (block) {
+        memcpy(sample_p, block, sizeof(dacsample_t) * AUDIO_DAC_BUFFER_SIZE / 2);
+    } else {
+        for (uint8_t s = 0; s < AUDIO_DAC_BUFFER_SIZE / 2; s++) {
+            sample_p[s] = AUDIO_DAC_OFF_VALUE;
+        }
+    }
+
+    if ((OUTPUT_SHOULD_STOP == state) && audio_mixer_is_idle()) {
+        state = OUTPUT_OFF;
+    } else if (OUTPUT_OFF <= state) {
+        if (OUTPUT_OFF_2 == state) {
+            // stopping timer6 = stopping the DAC at whatever value it is currently pushing to the output = AUDIO_DAC_OFF_VALUE
+            gptStopTimer(&GPTD6);
+        } else {
+            state++;
+        }
+    }
+}
+
+static void dac_error(DACDriver *dacp, dacerror_t err) {
+    (void)dacp;
+    (void)err;
+
+    chSysHalt("DAC failure. halp");
+}
+
+static const GPTConfig gpt6cfg1 = {.frequency = AUDIO_DAC_SAMPLE_RATE * 3,
+                                   .callback  = NULL,
+                                   .cr2       = TIM_CR2_MMS_1, /* MMS = 010 = TRGO on Update Event.  */
+                                   .dier      = 0U};
+
+static const DACConfig dac_conf = {.init = AUDIO_DAC_OFF_VALUE, .datamode = DAC_DHRM_12BIT_RIGHT};
+
+/**
+ * @note The DAC_TRG(0) here selects the Timer 6 TRGO event, which is triggered
+ * on the rising edge after 3 APB1 clock cycles, causing our gpt6cfg1.frequency
+ * to be a third of what we expect.
+ */
+static const DACConversionGroup dac_conv_cfg = {.num_channels = 1U, .end_cb = dac_end, .error_cb = dac_error, .trigger = DAC_TRG(0b000)};
+
+void audio_driver_initialize_impl(void) {
+    audio_mixer_init(AUDIO_DAC_MIXER_OUTPUT_RATE);
+#if defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRIANGLE)
+    audio_mixer_set_waveform(AUDIO_MIXER_WAVEFORM_TRIANGLE);
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_TRAPEZOID)
+    audio_mixer_set_waveform(AUDIO_MIXER_WAVEFORM_TRAPEZOID);
+#elif defined(AUDIO_DAC_SAMPLE_WAVEFORM_SQUARE)
+    audio_mixer_set_waveform(AUDIO_MIXER_WAVEFORM_SQUARE);
+#endif
+
+    if ((AUDIO_PIN == A4) || (AUDIO_PIN_ALT == A4)) {
+        palSetLineMode(A4, PAL_MODE_INPUT_ANALOG);
+        dacStart(&DACD1, &dac_conf);
+    }
+    if ((AUDIO_PIN == A5) || (AUDIO_PIN_ALT == A5)) {
+        palSetLineMode(A5, PAL_MODE_INPUT_ANALOG);
+        dacStart(&DACD2, &dac_conf);
+    }
+
+    // enable the output buffer, see the additive driver for details
+    DACD1.params->dac->CR &= ~DAC_CR_BOFF1;
+    DACD2.params->dac->CR &= ~DAC_CR_BOFF2;
+
+    for (size_t i = 0; i < AUDIO_DAC_BUFFER_SIZE; i++) {
+        dac_buffer[i] = AUDIO_DAC_OFF_VALUE;
+    }
+
+    if (AUDIO_PIN == A4) {
+        dacStartConversion(&DACD1, &dac_conv_cfg, dac_buffer, AUDIO_DAC_BUFFER_SIZE);
+    } else if (AUDIO_PIN == A5) {
+        dacStartConversion(&DACD2, &dac_conv_cfg, dac_buffer, AUDIO_DAC_BUFFER_SIZE);
+    }
+
+    // no inverted/out-of-phase waveform (yet?), only pulling AUDIO_PIN_ALT to AUDIO_DAC_OFF_VALUE
+#if defined(AUDIO_PIN_ALT_AS_NEGATIVE)
+    if (AUDIO_PIN_ALT == A4) {
+        dacPutChannelX(&DACD1, 0, AUDIO_DAC_OFF_VALUE);
+    } else if (AUDIO_PIN_ALT == A5) {
+        dacPutChannelX(&DACD2, 0, AUDIO_DAC_OFF_VALUE);
+    }
+#endif
+
+    gptStart(&GPTD6, &gpt6cfg1);
+}
+
+void audio_driver_stop_impl(void) {
+    state = OUTPUT_SHOULD_STOP;
+}
+
+void audio_driver_start_impl(void) {
+    // the mixer picks up the new tones from the main loop and fades them in
+    state = OUTPUT_RUN_NORMALLY;
+    gptStartContinuous(&GPTD6, 2U);
+}
@@ -6,10 +6,81 @@
 #include "serial.h"
 #include "serial_protocol.h"
 #include "synchronization_util.h"
+#include "timer.h"
 
 static inline bool initiate_transaction(uint8_t transaction_id);
 static inline bool react_to_transaction(void);
 
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+#    if !defined(SERIAL_USART_FULL_DUPLEX)
+#        error "In-band attention requests need SERIAL_USART_FULL_DUPLEX, use SPLIT_PUSH_PIN for half duplex"
+#    endif
+
+/* Sent by the slave outside of transactions, can't be mistaken for a handshake. */
+#    define SPLIT_PUSH_ATTENTION 0xA5
+_Static_assert(SPLIT_PUSH_ATTENTION >= 2 * NUM_TOTAL_TRANSACTIONS, "Attention request collides with handshakes");
+
+static bool attention_seen = false;
+
+/**
+ * @brief Picks attention requests out of whatever the slave sent since the
+ * last transaction.
+ */
+static inline void collect_attention(void) {
+    uint8_t byte;
+    while (serial_transport_poll(&byte)) {
+        if (byte == SPLIT_PUSH_ATTENTION) {
+            attention_seen = true;
+        }
+    }
+}
+
+bool soft_serial_attention(void) {
+    collect_attention();
+    bool seen      = attention_seen;
+    attention_seen = false;
+    return seen;
+}
+
+/**
+ * @brief Repeats the attention request once per millisecond while something
+ * is pending, so a request lost to a transaction starting is sent again.
+ */
+void soft_serial_signal(bool pending) {
+    static uint32_t last_signal = 0;
+    if (!pending || timer_read32() == last_signal) {
+        return;
+    }
+    last_signal = timer_read32();
+
+    /* The slave thread holds the lock for the whole of a transaction. */
+    split_shared_memory_lock();
+    uint8_t attention = SPLIT_PUSH_ATTENTION;
+    serial_transport_send(&attention, sizeof(attention));
+    split_shared_memory_unlock();
+}
+#endif // defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+
+/**
+ * @brief Receive a transaction buffer, only the announced part of length
+ * prefixed ones.
+ */
+static inline bool receive_transaction_buffer(split_transaction_desc_t* transaction, uint8_t* buffer, uint8_t size) {
+#ifdef SPLIT_TRANSACTION_LENGTH_PREFIXED
+    if (transaction->flags & SPLIT_TRANSACTION_LENGTH_PREFIXED) {
+        if (unlikely(!serial_transport_receive(buffer, 1) || buffer[0] >= size)) {
+            return false;
+        }
+        return buffer[0] == 0 || serial_transport_receive(buffer + 1, buffer[0]);
+    }
+#endif // SPLIT_TRANSACTION_LENGTH_PREFIXED
+    return serial_transport_receive(buffer, size);
+}
+
+static inline bool send_transaction_buffer(split_transaction_desc_t* transaction, const uint8_t* buffer, uint8_t size) {
+    return serial_transport_send(buffer, split_trans_buffer_length(transaction, buffer, size));
+}
+
 /**
  * @brief This thread runs on the slave and responds to transactions initiated
  * by the master.
@@ -73,7 +144,7 @@ static inline bool react_to_transaction(void) {
 
     /* Receive transaction buffer from the master. If this transaction requires it.*/
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             return false;
         }
     }
@@ -85,7 +156,7 @@ static inline bool react_to_transaction(void) {
 
     /* Send transaction buffer to the master. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!send_transaction_buffer(transaction, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             return false;
         }
     }
@@ -100,6 +171,10 @@ static inline bool react_to_transaction(void) {
  * @return bool Indicates success of transaction.
  */
 bool soft_serial_transaction(int index) {
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+    collect_attention();
+#endif // defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+
     /* Clear the receive queue, to start with a clean slate.
      * Parts of failed transactions or spurious bytes could still be in it. */
     serial_transport_driver_clear();
@@ -133,14 +208,22 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
      *   - due to the half duplex limitations on return codes, we always have to read *something*.
      *   - without the read, write only transactions *always* succeed, even during the boot process where the slave is not ready.
      */
-    if (unlikely(!serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake)) || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
+    bool shake_received = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+    /* An attention request may have been on its way before the slave saw the transaction. */
+    if (shake_received && transaction_id_shake == SPLIT_PUSH_ATTENTION) {
+        attention_seen = true;
+        shake_received = serial_transport_receive(&transaction_id_shake, sizeof(transaction_id_shake));
+    }
+#endif // defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+    if (unlikely(!shake_received || (transaction_id_shake != (transaction_id ^ NUM_TOTAL_TRANSACTIONS)))) {
         serial_dprintf("SPLIT: receiving handshake failed\n");
         return false;
     }
 
     /* Send transaction buffer to the slave. If this transaction requires it. */
     if (transaction->initiator2target_buffer_size) {
-        if (unlikely(!serial_transport_send(split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
+        if (unlikely(!send_transaction_buffer(transaction, split_trans_initiator2target_buffer(transaction), transaction->initiator2target_buffer_size))) {
             serial_dprintf("SPLIT: sending buffer failed\n");
             return false;
         }
@@ -148,7 +231,7 @@ static inline bool initiate_transaction(uint8_t transaction_id) {
 
     /* Receive transaction buffer from the slave. If this transaction requires it. */
     if (transaction->target2initiator_buffer_size) {
-        if (unlikely(!serial_transport_receive(split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
+        if (unlikely(!receive_transaction_buffer(transaction, split_trans_target2initiator_buffer(transaction), transaction->target2initiator_buffer_size))) {
             serial_dprintf("SPLIT: receiving buffer failed\n");
             return false;
         }
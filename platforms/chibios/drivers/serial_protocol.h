@@ -47,3 +47,11 @@ bool __attribute__((nonnull, hot)) serial_transport_receive_blocking(uint8_t* de
  * @return false Send failed, e.g. by timeout or bit errors.
  */
 bool __attribute__((nonnull, hot)) serial_transport_send(const uint8_t* source, const size_t size);
+
+/**
+ * @brief Non-blocking receive of a single byte.
+ *
+ * @return true A byte was waiting.
+ * @return false Nothing received.
+ */
+bool __attribute__((nonnull)) serial_transport_poll(uint8_t* destination);
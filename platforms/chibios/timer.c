@@ -105,3 +105,12 @@ uint16_t timer_elapsed(uint16_t last) {
 uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(timer_read32(), last);
 }
+
+uint32_t timer_read_cycles(void) {
+#if defined(PORT_SUPPORTS_RT) && (PORT_SUPPORTS_RT == TRUE)
+    return (uint32_t)chSysGetRealtimeCounterX();
+#else
+    // No cycle counter on this core, fall back to system ticks
+    return (uint32_t)chVTGetSystemTimeX();
+#endif
+}
@@ -0,0 +1,138 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "serial.h"
+#include "serial_loopback.h"
+
+static split_shared_memory_t   slave_memory;
+static split_shared_memory_t   master_memory;
+static serial_loopback_stats_t stats;
+static bool                    in_slave;
+static uint8_t                 drop_count;
+static int16_t                 lose_reply_after;
+static bool                    corrupt_next;
+static bool                    attention;
+static bool                    lose_attention;
+
+void soft_serial_initiator_init(void) {}
+
+void soft_serial_target_init(void) {}
+
+void serial_loopback_reset(void) {
+    memset(split_shmem, 0, sizeof(split_shared_memory_t));
+    memset(&slave_memory, 0, sizeof(slave_memory));
+    memset(&stats, 0, sizeof(stats));
+    in_slave         = false;
+    drop_count       = 0;
+    lose_reply_after = -1;
+    corrupt_next     = false;
+    attention        = false;
+    lose_attention   = false;
+}
+
+const serial_loopback_stats_t *serial_loopback_get_stats(void) {
+    return &stats;
+}
+
+static void enter_slave(void) {
+    memcpy(&master_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &slave_memory, sizeof(split_shared_memory_t));
+    in_slave = true;
+}
+
+static void leave_slave(void) {
+    memcpy(&slave_memory, split_shmem, sizeof(split_shared_memory_t));
+    memcpy(split_shmem, &master_memory, sizeof(split_shared_memory_t));
+    in_slave = false;
+}
+
+void serial_loopback_slave(void (*function)(void)) {
+    enter_slave();
+    function();
+    leave_slave();
+}
+
+bool serial_loopback_is_slave(void) {
+    return in_slave;
+}
+
+void serial_loopback_drop(uint8_t count) {
+    drop_count = count;
+}
+
+void serial_loopback_lose_reply(uint8_t after) {
+    lose_reply_after = after;
+}
+
+void serial_loopback_corrupt_next(void) {
+    corrupt_next = true;
+}
+
+void serial_loopback_lose_attention(void) {
+    lose_attention = true;
+}
+
+#if defined(SPLIT_TRANSPORT_PUSH) && !defined(SPLIT_PUSH_PIN)
+bool soft_serial_attention(void) {
+    bool seen = attention;
+    attention = false;
+    return seen;
+}
+
+void soft_serial_signal(bool pending) {
+    if (!pending) {
+        return;
+    }
+    stats.bytes++;
+    if (lose_attention) {
+        lose_attention = false;
+    } else {
+        attention = true;
+    }
+}
+#endif
+
+bool soft_serial_transaction(int index) {
+    if (index < 0 || index >= NUM_TOTAL_TRANSACTIONS) {
+        return false;
+    }
+    if (drop_count > 0) {
+        drop_count--;
+        stats.failures++;
+        return false;
+    }
+
+    split_transaction_desc_t *trans  = &split_transaction_table[index];
+    uint8_t                  *master = split_shmem_offset_ptr(0);
+    uint8_t                  *slave  = (uint8_t *)&slave_memory;
+
+    // The ID and the handshake
+    stats.bytes += 2;
+
+    uint8_t length = split_trans_buffer_length(trans, master + trans->initiator2target_offset, trans->initiator2target_buffer_size);
+    memcpy(slave + trans->initiator2target_offset, master + trans->initiator2target_offset, length);
+    stats.bytes += length;
+
+    enter_slave();
+    if (trans->slave_callback) {
+        trans->slave_callback(trans->initiator2target_buffer_size, split_trans_initiator2target_buffer(trans), trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(trans));
+    }
+    leave_slave();
+
+    if (lose_reply_after >= 0 && lose_reply_after-- == 0) {
+        stats.failures++;
+        return false;
+    }
+
+    length = split_trans_buffer_length(trans, slave + trans->target2initiator_offset, trans->target2initiator_buffer_size);
+    memcpy(master + trans->target2initiator_offset, slave + trans->target2initiator_offset, length);
+    if (corrupt_next && length > 0) {
+        master[trans->target2initiator_offset + length - 1] ^= 0x01;
+        corrupt_next = false;
+    }
+    stats.bytes += length;
+
+    stats.transactions++;
+    return true;
+}
@@ -0,0 +1,59 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Split serial transport stand-in for the test platform
+ *
+ * Both halves run in the same process: the slave keeps its own copy of the split shared memory,
+ * which is swapped in while its side of a transaction, or anything passed to serial_loopback_slave,
+ * runs. The wire is modelled after the ChibiOS serial protocol, counting the transaction ID and its
+ * handshake along with the buffers, and a byte for each in-band attention request.
+ */
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+    uint32_t failures;
+} serial_loopback_stats_t;
+
+/**
+ * \brief Resets both copies of the shared memory, the statistics and pending faults.
+ */
+void serial_loopback_reset(void);
+
+const serial_loopback_stats_t *serial_loopback_get_stats(void);
+
+/**
+ * \brief Runs the given function as the slave, with its shared memory in place.
+ */
+void serial_loopback_slave(void (*function)(void));
+
+/**
+ * \brief Whether the slave side is currently running.
+ */
+bool serial_loopback_is_slave(void);
+
+/**
+ * \brief Makes the next transactions fail before reaching the slave.
+ */
+void serial_loopback_drop(uint8_t count);
+
+/**
+ * \brief Loses the reply to a transaction once the slave has handled it, after letting the given number of others through.
+ */
+void serial_loopback_lose_reply(uint8_t after);
+
+/**
+ * \brief Flips a bit in the next buffer sent by the slave.
+ */
+void serial_loopback_corrupt_next(void);
+
+/**
+ * \brief Loses the next attention request sent by the slave.
+ */
+void serial_loopback_lose_attention(void);
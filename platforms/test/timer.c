@@ -68,6 +68,11 @@ uint32_t timer_elapsed32(uint32_t last) {
     return TIMER_DIFF_32(timer_read32(), last);
 }
 
+uint32_t timer_read_cycles(void) {
+    // One cycle per simulated millisecond, read without ticking the simulated clock
+    return current_time;
+}
+
 void set_time(uint32_t t) {
     current_time   = t;
     access_counter = 0;
@@ -43,10 +43,22 @@ uint32_t timer_read32(void);
 uint16_t timer_elapsed(uint16_t last);
 uint32_t timer_elapsed32(uint32_t last);
 
+// Free-running counter for profiling, in platform specific units (CPU cycles where the hardware has a cycle counter)
+uint32_t timer_read_cycles(void);
+
 // Utility functions to check if a future time has expired & autmatically handle time wrapping if checked / reset frequently (half of max value)
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
 
+// Returned by the *_time_until_next() deadline queries when nothing is pending
+#define TIMER_NO_DEADLINE UINT32_MAX
+
+// Milliseconds left until `period` has elapsed since `last`, or zero once it has
+static inline uint32_t timer_remaining(uint16_t last, uint16_t period) {
+    uint16_t elapsed = timer_elapsed(last);
+    return elapsed >= period ? 0 : period - elapsed;
+}
+
 // Use an appropriate timer integer size based on architecture (16-bit will overflow sooner)
 #if FAST_TIMER_T_SIZE < 32
 #    define TIMER_DIFF_FAST(a, b) TIMER_DIFF_16(a, b)
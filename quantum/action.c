@@ -135,6 +135,23 @@ if (QS_oneshot_timeout > 0) {
 #endif
 }
 
+/** \brief Time until action_exec next needs a tick event
+ *
+ * Tick events only drive the tapping and one shot timeouts, so they can be skipped until one of those is due.
+ *
+ * \return milliseconds until the next timeout, zero if tick events are needed now, or TIMER_NO_DEADLINE when idle
+ */
+uint32_t action_exec_time_until_next(void) {
+    uint32_t next = TIMER_NO_DEADLINE;
+#ifndef NO_ACTION_ONESHOT
+    next = MIN(next, oneshot_time_until_next());
+#endif
+#ifndef NO_ACTION_TAPPING
+    next = MIN(next, action_tapping_time_until_next());
+#endif
+    return next;
+}
+
 #ifdef SWAP_HANDS_ENABLE
 extern const keypos_t PROGMEM hand_swap_config[MATRIX_ROWS][MATRIX_COLS];
 #    ifdef ENCODER_MAP_ENABLE
@@ -56,7 +56,8 @@ typedef struct {
 } keyrecord_t;
 
 /* Execute action per keyevent */
-void action_exec(keyevent_t event);
+void     action_exec(keyevent_t event);
+uint32_t action_exec_time_until_next(void);
 
 /* action for key */
 action_t action_for_key(uint8_t layer, keypos_t key);
@@ -301,6 +301,105 @@ uint8_t read_source_layers_cache(keypos_t key) {
 }
 #endif
 
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+/** \brief layer switch cache
+ *
+ * Bit n of an entry is set when layer n has a non-transparent action for the key, so the layer
+ * a key resolves to is the highest bit that is also set in the active layer state.
+ */
+static layer_state_t layer_switch_cache[MATRIX_ROWS * MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static layer_state_t encoder_layer_switch_cache[NUM_ENCODERS][2];
+#    endif // ENCODER_MAP_ENABLE
+static bool layer_switch_cache_valid = false;
+
+/** \brief get layer switch cache entry
+ *
+ * Returns the cache entry of a key, or NULL for positions that are not cached
+ */
+static layer_state_t *layer_switch_cache_entry(keypos_t key) {
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        return &layer_switch_cache[(uint16_t)(key.row * MATRIX_COLS) + key.col];
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    else if (key.row == KEYLOC_ENCODER_CW && key.col < NUM_ENCODERS) {
+        return &encoder_layer_switch_cache[key.col][0];
+    } else if (key.row == KEYLOC_ENCODER_CCW && key.col < NUM_ENCODERS) {
+        return &encoder_layer_switch_cache[key.col][1];
+    }
+#    endif // ENCODER_MAP_ENABLE
+    return NULL;
+}
+
+/** \brief get non-transparent layers
+ *
+ * Looks up the key on every layer
+ */
+static layer_state_t layer_switch_cache_read_key(keypos_t key) {
+    layer_state_t layers = 0;
+    for (uint8_t i = 0; i < MAX_LAYER; i++) {
+        if (action_for_key(i, key).code != ACTION_TRANSPARENT) {
+            layers |= (layer_state_t)1 << i;
+        }
+    }
+    return layers;
+}
+
+/** \brief build layer switch cache
+ *
+ * Fills every entry from the keymap
+ */
+static void layer_switch_cache_build(void) {
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            keypos_t key                                = {.col = col, .row = row};
+            layer_switch_cache[row * MATRIX_COLS + col] = layer_switch_cache_read_key(key);
+        }
+    }
+#    ifdef ENCODER_MAP_ENABLE
+    for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+        encoder_layer_switch_cache[encoder][0] = layer_switch_cache_read_key((keypos_t){.col = encoder, .row = KEYLOC_ENCODER_CW});
+        encoder_layer_switch_cache[encoder][1] = layer_switch_cache_read_key((keypos_t){.col = encoder, .row = KEYLOC_ENCODER_CCW});
+    }
+#    endif // ENCODER_MAP_ENABLE
+    layer_switch_cache_valid = true;
+}
+
+void layer_switch_cache_invalidate(void) {
+    layer_switch_cache_valid = false;
+}
+
+/** \brief layer switch cache task
+ *
+ * Rebuilds the cache after it was invalidated, from the main loop rather than on a key press
+ */
+void layer_switch_cache_task(void) {
+    if (layer_switch_cache_valid) {
+        return;
+    }
+#    ifdef VIAL_ENABLE
+    /* the keymap reads as KC_NO while unlocking */
+    if (vial_unlock_in_progress) {
+        return;
+    }
+#    endif
+    layer_switch_cache_build();
+}
+
+void layer_switch_cache_update(uint8_t layer, keypos_t key) {
+    layer_state_t *entry = layer_switch_cache_entry(key);
+    if (!layer_switch_cache_valid || entry == NULL || layer >= MAX_LAYER) {
+        return;
+    }
+
+    if (action_for_key(layer, key).code != ACTION_TRANSPARENT) {
+        *entry |= (layer_state_t)1 << layer;
+    } else {
+        *entry &= ~((layer_state_t)1 << layer);
+    }
+}
+#endif
+
 /** \brief Store or get action (FIXME: Needs better summary)
  *
  * Make sure the action triggered when the key is released is the same
@@ -338,6 +437,20 @@ uint8_t layer_switch_get_layer(keypos_t key) {
     action.code = ACTION_TRANSPARENT;
 
     layer_state_t layers = layer_state | default_layer_state;
+#    ifdef LAYER_SWITCH_CACHE
+    /* walks the layers until the main loop has rebuilt an invalidated cache */
+    layer_state_t *entry = layer_switch_cache_valid ? layer_switch_cache_entry(key) : NULL;
+#        ifdef VIAL_ENABLE
+    /* the keymap reads as KC_NO while unlocking */
+    if (vial_unlock_in_progress) {
+        entry = NULL;
+    }
+#        endif
+    if (entry != NULL) {
+        /* falls back to layer 0 when no active layer maps the key */
+        return get_highest_layer(*entry & layers);
+    }
+#    endif
     /* check top layer first */
     for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
         if (layers & ((layer_state_t)1 << i)) {
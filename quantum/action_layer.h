@@ -163,6 +163,13 @@ uint8_t read_source_layers_cache(keypos_t key);
 #endif
 action_t store_or_get_action(bool pressed, keypos_t key);
 
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+/* resolved layer cache, must be told about keymap edits */
+void layer_switch_cache_invalidate(void);
+void layer_switch_cache_update(uint8_t layer, keypos_t key);
+void layer_switch_cache_task(void);
+#endif
+
 /* return the topmost non-transparent layer currently associated with key */
 uint8_t layer_switch_get_layer(keypos_t key);
 
@@ -0,0 +1,181 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <random>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "mock.h"
+#include "keycodes.h"
+}
+
+class LayerSwitchCache : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        std::mt19937 random(1234);
+
+        // Mostly transparent upper layers, as on boards with many dynamic layers
+        for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                    mock_keymap[layer][row][col] = keycode_for(random, layer);
+                }
+            }
+            for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+                mock_encodermap[layer][encoder][0] = keycode_for(random, layer);
+                mock_encodermap[layer][encoder][1] = keycode_for(random, layer);
+            }
+        }
+        default_layer_state = 1;
+        layer_state         = 0;
+        layer_switch_cache_invalidate();
+        layer_switch_cache_task();
+    }
+
+    static uint16_t keycode_for(std::mt19937 &random, uint8_t layer) {
+        if (layer > 0 && random() % 4 != 0) {
+            return KC_TRANSPARENT;
+        }
+        return KC_A + random() % 26;
+    }
+
+    // layer_switch_get_layer() without the cache
+    static uint8_t expected_layer(keypos_t key) {
+        layer_state_t layers = layer_state | default_layer_state;
+        for (int8_t i = MAX_LAYER - 1; i >= 0; i--) {
+            if ((layers & ((layer_state_t)1 << i)) && action_for_key(i, key).code != ACTION_TRANSPARENT) {
+                return i;
+            }
+        }
+        return 0;
+    }
+
+    static void expect_all_keys_resolved(void) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                keypos_t key = {.col = col, .row = row};
+                ASSERT_EQ(layer_switch_get_layer(key), expected_layer(key)) << "row " << +row << " col " << +col << " layers " << layer_state;
+            }
+        }
+    }
+};
+
+TEST_F(LayerSwitchCache, MatchesLayerWalk) {
+    std::mt19937 random(42);
+
+    for (int i = 0; i < 200; i++) {
+        layer_state = random();
+        expect_all_keys_resolved();
+    }
+}
+
+TEST_F(LayerSwitchCache, DefaultLayerChanges) {
+    layer_state = 0x0006;
+    for (uint8_t layer = 0; layer < MAX_LAYER; layer++) {
+        default_layer_state = (layer_state_t)1 << layer;
+        expect_all_keys_resolved();
+    }
+}
+
+TEST_F(LayerSwitchCache, FallsBackToLayerZero) {
+    keypos_t key                     = {.col = 3, .row = 2};
+    mock_keymap[0][key.row][key.col] = KC_TRANSPARENT;
+    mock_keymap[4][key.row][key.col] = KC_TRANSPARENT;
+    layer_switch_cache_invalidate();
+    layer_switch_cache_task();
+
+    default_layer_state = 0;
+    layer_state         = 1 << 4;
+    EXPECT_EQ(layer_switch_get_layer(key), 0);
+}
+
+TEST_F(LayerSwitchCache, ResolvingMakesNoKeymapLookups) {
+    keypos_t key = {.col = 0, .row = 0};
+    layer_switch_get_layer(key);
+
+    mock_lookups = 0;
+    for (layer_state_t layers = 0; layers < 0x100; layers++) {
+        layer_state = layers;
+        layer_switch_get_layer(key);
+    }
+    EXPECT_EQ(mock_lookups, 0);
+}
+
+TEST_F(LayerSwitchCache, EditedKeyIsUpdated) {
+    keypos_t key = {.col = 20, .row = 5};
+    layer_state  = 0xFFFF;
+    expect_all_keys_resolved();
+
+    mock_keymap[MAX_LAYER - 1][key.row][key.col] = KC_B;
+    layer_switch_cache_update(MAX_LAYER - 1, key);
+    EXPECT_EQ(layer_switch_get_layer(key), MAX_LAYER - 1);
+
+    mock_keymap[MAX_LAYER - 1][key.row][key.col] = KC_TRANSPARENT;
+    layer_switch_cache_update(MAX_LAYER - 1, key);
+    expect_all_keys_resolved();
+}
+
+TEST_F(LayerSwitchCache, InvalidateRebuilds) {
+    layer_state = 0xFFFF;
+    expect_all_keys_resolved();
+
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            mock_keymap[9][row][col] = KC_C;
+        }
+    }
+    layer_switch_cache_invalidate();
+    expect_all_keys_resolved();
+    layer_switch_cache_task();
+    expect_all_keys_resolved();
+}
+
+TEST_F(LayerSwitchCache, PressesDontRebuild) {
+    keypos_t key = {.col = 0, .row = 0};
+    layer_state  = 0xFFFF;
+    layer_switch_cache_invalidate();
+
+    // Each press walks the layers until the task has run
+    mock_lookups = 0;
+    layer_switch_get_layer(key);
+    layer_switch_get_layer(key);
+    EXPECT_LE(mock_lookups, 2 * MAX_LAYER);
+
+    layer_switch_cache_task();
+    mock_lookups  = 0;
+    uint8_t layer = layer_switch_get_layer(key);
+    EXPECT_EQ(mock_lookups, 0);
+    EXPECT_EQ(layer, expected_layer(key));
+}
+
+TEST_F(LayerSwitchCache, Encoders) {
+    std::mt19937 random(7);
+
+    for (int i = 0; i < 50; i++) {
+        layer_state = random();
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            keypos_t cw  = {.col = encoder, .row = KEYLOC_ENCODER_CW};
+            keypos_t ccw = {.col = encoder, .row = KEYLOC_ENCODER_CCW};
+            EXPECT_EQ(layer_switch_get_layer(cw), expected_layer(cw));
+            EXPECT_EQ(layer_switch_get_layer(ccw), expected_layer(ccw));
+        }
+    }
+
+    keypos_t cw                               = {.col = 1, .row = KEYLOC_ENCODER_CW};
+    mock_encodermap[MAX_LAYER - 1][cw.col][0] = KC_VOLU;
+    layer_switch_cache_update(MAX_LAYER - 1, cw);
+    layer_state = 0xFFFF;
+    EXPECT_EQ(layer_switch_get_layer(cw), MAX_LAYER - 1);
+}
+
+TEST_F(LayerSwitchCache, ReleaseUsesLayerOfPress) {
+    keypos_t key                     = {.col = 1, .row = 1};
+    mock_keymap[3][key.row][key.col] = KC_D;
+    layer_switch_cache_update(3, key);
+
+    layer_state = 1 << 3;
+    EXPECT_EQ(store_or_get_action(true, key).code, ACTION_KEY(KC_D));
+    layer_state = 0;
+    EXPECT_EQ(store_or_get_action(false, key).code, ACTION_KEY(KC_D));
+    EXPECT_EQ(store_or_get_action(true, key).code, ACTION_KEY(mock_keymap[0][key.row][key.col]));
+}
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 21
+
+#define NUM_ENCODERS 2
+
+#define LAYER_SWITCH_CACHE
@@ -0,0 +1,30 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "mock.h"
+#include "keycodes.h"
+
+uint16_t mock_keymap[MAX_LAYER][MATRIX_ROWS][MATRIX_COLS];
+uint16_t mock_encodermap[MAX_LAYER][NUM_ENCODERS][2];
+uint32_t mock_lookups = 0;
+
+action_t action_for_key(uint8_t layer, keypos_t key) {
+    uint16_t keycode = KC_NO;
+    action_t action  = {};
+
+    mock_lookups++;
+    if (key.row < MATRIX_ROWS && key.col < MATRIX_COLS) {
+        keycode = mock_keymap[layer][key.row][key.col];
+    } else if (key.row == KEYLOC_ENCODER_CW && key.col < NUM_ENCODERS) {
+        keycode = mock_encodermap[layer][key.col][0];
+    } else if (key.row == KEYLOC_ENCODER_CCW && key.col < NUM_ENCODERS) {
+        keycode = mock_encodermap[layer][key.col][1];
+    }
+    action.code = keycode == KC_TRANSPARENT ? ACTION_TRANSPARENT : ACTION_KEY(keycode);
+    return action;
+}
+
+void clear_keyboard_but_mods(void) {}
+void clear_keyboard_but_mods_and_keys(void) {}
+
+bool disable_action_cache = false;
@@ -0,0 +1,10 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+#include "action_layer.h"
+
+extern uint16_t mock_keymap[MAX_LAYER][MATRIX_ROWS][MATRIX_COLS];
+extern uint16_t mock_encodermap[MAX_LAYER][NUM_ENCODERS][2];
+extern uint32_t mock_lookups;
@@ -0,0 +1,8 @@
+action_layer_cache_DEFS := -DENCODER_MAP_ENABLE
+action_layer_cache_CONFIG := $(QUANTUM_PATH)/action_layer/tests/config_mock.h
+
+action_layer_cache_SRC := \
+	$(QUANTUM_PATH)/action_layer/tests/mock.c \
+	$(QUANTUM_PATH)/action_layer/tests/action_layer_cache_tests.cpp \
+	$(QUANTUM_PATH)/action_layer.c \
+	$(QUANTUM_PATH)/bitwise.c
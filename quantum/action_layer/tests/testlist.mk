@@ -0,0 +1 @@
+TEST_LIST += action_layer_cache
@@ -112,6 +112,18 @@ void action_tapping_process(keyrecord_t record) {
     }
 }
 
+/** \brief Time until the tapping state machine next needs a tick event
+ *
+ * \return milliseconds until the tapping key times out, zero if tick events are needed now, or TIMER_NO_DEADLINE when idle
+ */
+uint32_t action_tapping_time_until_next(void) {
+    if (IS_NOEVENT(tapping_key.event)) {
+        // Anything left in the waiting buffer is drained by the next tick event
+        return waiting_buffer_head != waiting_buffer_tail ? 0 : TIMER_NO_DEADLINE;
+    }
+    return timer_remaining(tapping_key.event.time, GET_TAPPING_TERM(get_record_keycode(&tapping_key, false), &tapping_key));
+}
+
 /* Some conditionally defined helper macros to keep process_tapping more
  * readable. The conditional definition of tapping_keycode and all the
  * conditional uses of it are hidden inside macros named TAP_...
@@ -238,6 +238,29 @@ bool is_oneshot_enabled(void) {
     return keymap_config.oneshot_enable;
 }
 
+/** \brief Time until the next one shot timeout
+ *
+ * \return milliseconds until an active one shot mod or layer times out, or TIMER_NO_DEADLINE if none can
+ */
+uint32_t oneshot_time_until_next(void) {
+    uint32_t next = TIMER_NO_DEADLINE;
+    if (!keymap_config.oneshot_enable || QS_oneshot_timeout == 0) {
+        return next;
+    }
+    if (oneshot_mods) {
+        next = MIN(next, timer_remaining(oneshot_time, QS_oneshot_timeout));
+    }
+    if (get_oneshot_layer_state() && !(get_oneshot_layer_state() & ONESHOT_TOGGLED)) {
+        next = MIN(next, timer_remaining(oneshot_layer_time, QS_oneshot_timeout));
+    }
+#    ifdef SWAP_HANDS_ENABLE
+    if (swap_hands_oneshot == SHO_ACTIVE) {
+        next = MIN(next, timer_remaining(oneshot_swaphands_time, QS_oneshot_timeout));
+    }
+#    endif
+    return next;
+}
+
 #endif
 
 static uint8_t get_mods_for_report(void) {
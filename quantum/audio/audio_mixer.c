@@ -0,0 +1,228 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stddef.h>
+#include "audio.h"
+#include "audio_mixer.h"
+#include "audio_mixer_wavetables.h"
+#include "timer.h"
+#include "util.h"
+
+// Full scale of a voice, the gains of all sounding voices add up to this
+#define AUDIO_MIXER_GAIN_MAX 32767
+#define AUDIO_MIXER_RAMP_STEP (AUDIO_MIXER_GAIN_MAX / AUDIO_MIXER_RAMP_SAMPLES)
+#define AUDIO_MIXER_CENTER (AUDIO_MIXER_SAMPLE_MAX / 2)
+
+// The top bits of the phase select the wavetable entry, the following ones interpolate to the next
+#define AUDIO_MIXER_PHASE_BITS 32
+#define AUDIO_MIXER_INDEX_SHIFT (AUDIO_MIXER_PHASE_BITS - 8)
+#define AUDIO_MIXER_FRACTION_SHIFT (AUDIO_MIXER_INDEX_SHIFT - 15)
+
+_Static_assert(AUDIO_MIXER_WAVETABLE_SIZE == 256, "The phase accumulator assumes a wavetable of 256 entries");
+_Static_assert(AUDIO_MIXER_RAMP_SAMPLES > 0 && AUDIO_MIXER_RAMP_SAMPLES <= AUDIO_MIXER_GAIN_MAX, "AUDIO_MIXER_RAMP_SAMPLES out of range");
+
+typedef struct {
+    float    frequency;
+    uint32_t phase;
+    uint32_t increment;
+    int32_t  gain;
+    int32_t  target;
+} audio_mixer_voice_t;
+
+static const int16_t *const wavetables[AUDIO_MIXER_WAVEFORM_COUNT] = {
+    [AUDIO_MIXER_WAVEFORM_SINE]      = audio_mixer_wavetable_sine,
+    [AUDIO_MIXER_WAVEFORM_TRIANGLE]  = audio_mixer_wavetable_triangle,
+    [AUDIO_MIXER_WAVEFORM_TRAPEZOID] = audio_mixer_wavetable_trapezoid,
+    [AUDIO_MIXER_WAVEFORM_SQUARE]    = audio_mixer_wavetable_square,
+};
+
+static audio_mixer_voice_t voices[AUDIO_MIXER_VOICES];
+static const int16_t      *wavetable = audio_mixer_wavetable_sine;
+static float               phase_scale;
+static uint8_t             synced_tones;
+
+static audio_mixer_sample_t blocks[AUDIO_MIXER_BLOCK_COUNT][AUDIO_MIXER_BLOCK_SIZE];
+// Free running, the difference is the number of blocks waiting to be read
+static volatile uint8_t  blocks_written;
+static volatile uint8_t  blocks_read;
+static volatile uint16_t underruns;
+
+void audio_mixer_init(uint32_t sample_rate) {
+    for (uint8_t i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        voices[i] = (audio_mixer_voice_t){0};
+    }
+    // Phase increment per Hz, a full period being the whole range of the accumulator
+    phase_scale    = 4294967296.0f / sample_rate;
+    synced_tones   = 0;
+    blocks_written = 0;
+    blocks_read    = 0;
+    underruns      = 0;
+}
+
+void audio_mixer_set_waveform(audio_mixer_waveform_t waveform) {
+    if (waveform < AUDIO_MIXER_WAVEFORM_COUNT) {
+        wavetable = wavetables[waveform];
+    }
+}
+
+static void voice_tune(audio_mixer_voice_t *voice, float frequency) {
+    voice->frequency = frequency;
+    voice->increment = (uint32_t)(frequency * phase_scale);
+}
+
+void audio_mixer_set_tones(const float *frequencies, uint8_t count) {
+    bool    claimed[AUDIO_MIXER_VOICES] = {false};
+    float   unmatched[AUDIO_MIXER_VOICES];
+    uint8_t unmatched_count = 0;
+    uint8_t playing         = 0;
+
+    // Voices already on one of the frequencies keep it, even if they were fading out
+    for (uint8_t i = 0; i < count && playing < AUDIO_MIXER_VOICES; i++) {
+        if (frequencies[i] <= 0.0f) {
+            continue;
+        }
+        playing++;
+
+        uint8_t v = 0;
+        while (v < AUDIO_MIXER_VOICES && (claimed[v] || voices[v].frequency != frequencies[i])) {
+            v++;
+        }
+        if (v < AUDIO_MIXER_VOICES) {
+            claimed[v] = true;
+        } else {
+            unmatched[unmatched_count++] = frequencies[i];
+        }
+    }
+
+    // Sounding voices are retuned first, which keeps vibrato and glissando continuous, then silent ones start from zero
+    for (uint8_t i = 0; i < unmatched_count; i++) {
+        int8_t best = -1;
+        for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+            if (!claimed[v] && (best < 0 || voices[v].gain > voices[best].gain)) {
+                best = v;
+            }
+        }
+        claimed[best] = true;
+        if (voices[best].gain == 0) {
+            voices[best].phase = 0;
+        }
+        voice_tune(&voices[best], unmatched[i]);
+    }
+
+    for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+        voices[v].target = claimed[v] ? AUDIO_MIXER_GAIN_MAX / playing : 0;
+    }
+}
+
+static inline int32_t wavetable_sample(const int16_t *table, uint32_t phase) {
+    uint8_t index    = phase >> AUDIO_MIXER_INDEX_SHIFT;
+    int32_t fraction = (phase >> AUDIO_MIXER_FRACTION_SHIFT) & 0x7FFF;
+    int32_t a        = table[index];
+    int32_t b        = table[(uint8_t)(index + 1)];
+    return a + (((b - a) * fraction) >> 15);
+}
+
+static void render_voice(audio_mixer_voice_t *voice, int32_t *mix, uint16_t count) {
+    uint32_t phase     = voice->phase;
+    uint32_t increment = voice->increment;
+    int32_t  gain      = voice->gain;
+    int32_t  target    = voice->target;
+
+    for (uint16_t s = 0; s < count; s++) {
+        if (gain < target) {
+            gain = MIN(gain + AUDIO_MIXER_RAMP_STEP, target);
+        } else if (gain > target) {
+            gain = MAX(gain - AUDIO_MIXER_RAMP_STEP, target);
+        }
+        mix[s] += (wavetable_sample(wavetable, phase) * gain) >> 15;
+        phase += increment;
+    }
+
+    voice->phase = phase;
+    voice->gain  = gain;
+}
+
+void audio_mixer_render(audio_mixer_sample_t *samples, uint16_t count) {
+    int32_t mix[AUDIO_MIXER_BLOCK_SIZE];
+
+    while (count > 0) {
+        uint16_t chunk = MIN(count, AUDIO_MIXER_BLOCK_SIZE);
+
+        for (uint16_t s = 0; s < chunk; s++) {
+            mix[s] = 0;
+        }
+        for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+            if (voices[v].gain != 0 || voices[v].target != 0) {
+                render_voice(&voices[v], mix, chunk);
+            }
+        }
+        // Voices fading in and out at the same time can briefly add up to more than full scale
+        for (uint16_t s = 0; s < chunk; s++) {
+            int32_t value = AUDIO_MIXER_CENTER + ((mix[s] * (int32_t)AUDIO_MIXER_CENTER) >> 15);
+            samples[s]    = MAX(0, MIN(value, (int32_t)AUDIO_MIXER_SAMPLE_MAX));
+        }
+
+        samples += chunk;
+        count -= chunk;
+    }
+}
+
+static bool voices_silent(void) {
+    for (uint8_t v = 0; v < AUDIO_MIXER_VOICES; v++) {
+        if (voices[v].gain != 0 || voices[v].target != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint8_t audio_mixer_fill(void) {
+    uint8_t rendered = 0;
+    while ((uint8_t)(blocks_written - blocks_read) < AUDIO_MIXER_BLOCK_COUNT && !voices_silent()) {
+        audio_mixer_render(blocks[blocks_written % AUDIO_MIXER_BLOCK_COUNT], AUDIO_MIXER_BLOCK_SIZE);
+        // Published only once the block is complete
+        blocks_written++;
+        rendered++;
+    }
+    return rendered;
+}
+
+const audio_mixer_sample_t *audio_mixer_read_block(void) {
+    if (blocks_read == blocks_written) {
+        if (!voices_silent()) {
+            underruns++;
+        }
+        return NULL;
+    }
+    return blocks[blocks_read++ % AUDIO_MIXER_BLOCK_COUNT];
+}
+
+bool audio_mixer_is_idle(void) {
+    return blocks_read == blocks_written && voices_silent();
+}
+
+uint16_t audio_mixer_get_underruns(void) {
+    return underruns;
+}
+
+void audio_mixer_task(void) {
+    // The note timing runs here instead of in the output ISR
+    bool    changed = audio_update_state();
+    uint8_t active  = audio_get_number_of_active_tones();
+
+    if (changed || active != synced_tones) {
+        float   frequencies[AUDIO_MIXER_VOICES];
+        uint8_t count = MIN(active, AUDIO_MIXER_VOICES);
+        for (uint8_t i = 0; i < count; i++) {
+            frequencies[i] = audio_get_processed_frequency(i);
+        }
+        audio_mixer_set_tones(frequencies, count);
+        synced_tones = active;
+    }
+
+    audio_mixer_fill();
+}
+
+uint32_t audio_mixer_time_until_next(void) {
+    return audio_mixer_is_idle() && !audio_is_playing_note() && !audio_is_playing_melody() ? TIMER_NO_DEADLINE : 0;
+}
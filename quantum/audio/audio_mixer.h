@@ -0,0 +1,130 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Block based wavetable mixer
+ *
+ * Renders the active tones into a ring of sample blocks from the main loop, so that the
+ * output ISR only has to copy a finished block to the hardware. Every voice runs a fixed
+ * point phase accumulator over a shared wavetable and ramps its gain up and down instead
+ * of waiting for a zero crossing, so tones can change at any sample.
+ */
+
+/**
+ * The number of tones mixed at the same time.
+ */
+#ifndef AUDIO_MIXER_VOICES
+#    ifdef AUDIO_MAX_SIMULTANEOUS_TONES
+#        define AUDIO_MIXER_VOICES AUDIO_MAX_SIMULTANEOUS_TONES
+#    else
+#        define AUDIO_MIXER_VOICES 4
+#    endif
+#endif
+
+/**
+ * Samples in each block, which should match what the output consumes per interrupt.
+ */
+#ifndef AUDIO_MIXER_BLOCK_SIZE
+#    ifdef AUDIO_DAC_BUFFER_SIZE
+#        define AUDIO_MIXER_BLOCK_SIZE (AUDIO_DAC_BUFFER_SIZE / 2)
+#    else
+#        define AUDIO_MIXER_BLOCK_SIZE 64
+#    endif
+#endif
+
+/**
+ * Blocks rendered ahead of the output. Together with the block size this sets how long the
+ * main loop may stall before the output runs dry, and how late tone changes are heard.
+ */
+#ifndef AUDIO_MIXER_BLOCK_COUNT
+#    define AUDIO_MIXER_BLOCK_COUNT 4
+#endif
+
+/**
+ * Samples taken by a voice to fade in or out completely.
+ */
+#ifndef AUDIO_MIXER_RAMP_SAMPLES
+#    define AUDIO_MIXER_RAMP_SAMPLES 64
+#endif
+
+#ifndef AUDIO_MIXER_SAMPLE_MAX
+#    ifdef AUDIO_DAC_SAMPLE_MAX
+#        define AUDIO_MIXER_SAMPLE_MAX AUDIO_DAC_SAMPLE_MAX
+#    else
+#        define AUDIO_MIXER_SAMPLE_MAX 4095U
+#    endif
+#endif
+
+#if AUDIO_MIXER_BLOCK_COUNT < 2 || AUDIO_MIXER_BLOCK_COUNT > 128 || (AUDIO_MIXER_BLOCK_COUNT & (AUDIO_MIXER_BLOCK_COUNT - 1)) != 0
+#    error "AUDIO_MIXER_BLOCK_COUNT must be a power of two between 2 and 128"
+#endif
+
+typedef uint16_t audio_mixer_sample_t;
+
+typedef enum {
+    AUDIO_MIXER_WAVEFORM_SINE,
+    AUDIO_MIXER_WAVEFORM_TRIANGLE,
+    AUDIO_MIXER_WAVEFORM_TRAPEZOID,
+    AUDIO_MIXER_WAVEFORM_SQUARE,
+    AUDIO_MIXER_WAVEFORM_COUNT,
+} audio_mixer_waveform_t;
+
+/**
+ * \brief Silences every voice and drops the rendered blocks.
+ *
+ * \param sample_rate the rate at which the output consumes samples
+ */
+void audio_mixer_init(uint32_t sample_rate);
+
+void audio_mixer_set_waveform(audio_mixer_waveform_t waveform);
+
+/**
+ * \brief Sets the frequencies to be played.
+ *
+ * Voices already playing one of the frequencies keep playing it, the others are retuned or
+ * faded in and out. Frequencies of zero are rests and are ignored, as are any beyond the
+ * number of voices.
+ */
+void audio_mixer_set_tones(const float *frequencies, uint8_t count);
+
+/**
+ * \brief Mixes the voices into the given buffer, independently of the block ring.
+ */
+void audio_mixer_render(audio_mixer_sample_t *samples, uint16_t count);
+
+/**
+ * \brief Renders blocks until the ring is full, or every voice has faded out.
+ *
+ * \return the number of blocks rendered
+ */
+uint8_t audio_mixer_fill(void);
+
+/**
+ * \brief Takes the oldest rendered block, safe to call from an ISR.
+ *
+ * \return AUDIO_MIXER_BLOCK_SIZE samples, which stay valid until the next fill, or NULL if
+ *         nothing has been rendered in time
+ */
+const audio_mixer_sample_t *audio_mixer_read_block(void);
+
+/**
+ * \brief Whether every voice has faded out and all rendered blocks have been read.
+ */
+bool audio_mixer_is_idle(void);
+
+/**
+ * \brief Number of times the output asked for a block before one was ready.
+ */
+uint16_t audio_mixer_get_underruns(void);
+
+/**
+ * \brief Follows the audio core's tones and keeps the block ring filled, run from the main loop.
+ */
+void audio_mixer_task(void);
+
+uint32_t audio_mixer_time_until_next(void);
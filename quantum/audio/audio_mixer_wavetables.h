@@ -0,0 +1,90 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Generated by util/audio_generate_dac_lut.py --mixer, do not edit
+
+#pragma once
+
+#include <stdint.h>
+
+#define AUDIO_MIXER_WAVETABLE_SIZE 256
+
+// One period of a sine wave, starting at zero and rising, as signed Q15
+static const int16_t audio_mixer_wavetable_sine[AUDIO_MIXER_WAVETABLE_SIZE] = {
+         0,    804,   1608,   2410,   3212,   4011,   4808,   5602,   6393,   7179,   7962,   8739,   9512,  10278,  11039,  11793,
+     12539,  13279,  14010,  14732,  15446,  16151,  16846,  17530,  18204,  18868,  19519,  20159,  20787,  21403,  22005,  22594,
+     23170,  23731,  24279,  24811,  25329,  25832,  26319,  26790,  27245,  27683,  28105,  28510,  28898,  29268,  29621,  29956,
+     30273,  30571,  30852,  31113,  31356,  31580,  31785,  31971,  32137,  32285,  32412,  32521,  32609,  32678,  32728,  32757,
+     32767,  32757,  32728,  32678,  32609,  32521,  32412,  32285,  32137,  31971,  31785,  31580,  31356,  31113,  30852,  30571,
+     30273,  29956,  29621,  29268,  28898,  28510,  28105,  27683,  27245,  26790,  26319,  25832,  25329,  24811,  24279,  23731,
+     23170,  22594,  22005,  21403,  20787,  20159,  19519,  18868,  18204,  17530,  16846,  16151,  15446,  14732,  14010,  13279,
+     12539,  11793,  11039,  10278,   9512,   8739,   7962,   7179,   6393,   5602,   4808,   4011,   3212,   2410,   1608,    804,
+         0,   -804,  -1608,  -2410,  -3212,  -4011,  -4808,  -5602,  -6393,  -7179,  -7962,  -8739,  -9512, -10278, -11039, -11793,
+    -12539, -13279, -14010, -14732, -15446, -16151, -16846, -17530, -18204, -18868, -19519, -20159, -20787, -21403, -22005, -22594,
+    -23170, -23731, -24279, -24811, -25329, -25832, -26319, -26790, -27245, -27683, -28105, -28510, -28898, -29268, -29621, -29956,
+    -30273, -30571, -30852, -31113, -31356, -31580, -31785, -31971, -32137, -32285, -32412, -32521, -32609, -32678, -32728, -32757,
+    -32767, -32757, -32728, -32678, -32609, -32521, -32412, -32285, -32137, -31971, -31785, -31580, -31356, -31113, -30852, -30571,
+    -30273, -29956, -29621, -29268, -28898, -28510, -28105, -27683, -27245, -26790, -26319, -25832, -25329, -24811, -24279, -23731,
+    -23170, -22594, -22005, -21403, -20787, -20159, -19519, -18868, -18204, -17530, -16846, -16151, -15446, -14732, -14010, -13279,
+    -12539, -11793, -11039, -10278,  -9512,  -8739,  -7962,  -7179,  -6393,  -5602,  -4808,  -4011,  -3212,  -2410,  -1608,   -804,
+};
+
+// One period of a triangle wave, starting at zero and rising, as signed Q15
+static const int16_t audio_mixer_wavetable_triangle[AUDIO_MIXER_WAVETABLE_SIZE] = {
+         0,    512,   1024,   1536,   2048,   2560,   3072,   3584,   4096,   4608,   5120,   5632,   6144,   6656,   7168,   7680,
+      8192,   8704,   9216,   9728,  10240,  10752,  11264,  11776,  12288,  12800,  13312,  13824,  14336,  14848,  15360,  15872,
+     16384,  16895,  17407,  17919,  18431,  18943,  19455,  19967,  20479,  20991,  21503,  22015,  22527,  23039,  23551,  24063,
+     24575,  25087,  25599,  26111,  26623,  27135,  27647,  28159,  28671,  29183,  29695,  30207,  30719,  31231,  31743,  32255,
+     32767,  32255,  31743,  31231,  30719,  30207,  29695,  29183,  28671,  28159,  27647,  27135,  26623,  26111,  25599,  25087,
+     24575,  24063,  23551,  23039,  22527,  22015,  21503,  20991,  20479,  19967,  19455,  18943,  18431,  17919,  17407,  16895,
+     16384,  15872,  15360,  14848,  14336,  13824,  13312,  12800,  12288,  11776,  11264,  10752,  10240,   9728,   9216,   8704,
+      8192,   7680,   7168,   6656,   6144,   5632,   5120,   4608,   4096,   3584,   3072,   2560,   2048,   1536,   1024,    512,
+         0,   -512,  -1024,  -1536,  -2048,  -2560,  -3072,  -3584,  -4096,  -4608,  -5120,  -5632,  -6144,  -6656,  -7168,  -7680,
+     -8192,  -8704,  -9216,  -9728, -10240, -10752, -11264, -11776, -12288, -12800, -13312, -13824, -14336, -14848, -15360, -15872,
+    -16384, -16895, -17407, -17919, -18431, -18943, -19455, -19967, -20479, -20991, -21503, -22015, -22527, -23039, -23551, -24063,
+    -24575, -25087, -25599, -26111, -26623, -27135, -27647, -28159, -28671, -29183, -29695, -30207, -30719, -31231, -31743, -32255,
+    -32767, -32255, -31743, -31231, -30719, -30207, -29695, -29183, -28671, -28159, -27647, -27135, -26623, -26111, -25599, -25087,
+    -24575, -24063, -23551, -23039, -22527, -22015, -21503, -20991, -20479, -19967, -19455, -18943, -18431, -17919, -17407, -16895,
+    -16384, -15872, -15360, -14848, -14336, -13824, -13312, -12800, -12288, -11776, -11264, -10752, -10240,  -9728,  -9216,  -8704,
+     -8192,  -7680,  -7168,  -6656,  -6144,  -5632,  -5120,  -4608,  -4096,  -3584,  -3072,  -2560,  -2048,  -1536,  -1024,   -512,
+};
+
+// One period of a trapezoid wave, starting at zero and rising, as signed Q15
+static const int16_t audio_mixer_wavetable_trapezoid[AUDIO_MIXER_WAVETABLE_SIZE] = {
+         0,   1536,   3072,   4608,   6144,   7680,   9216,  10752,  12288,  13824,  15360,  16895,  18431,  19967,  21503,  23039,
+     24575,  26111,  27647,  29183,  30719,  32255,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32255,  30719,  29183,  27647,  26111,
+     24575,  23039,  21503,  19967,  18431,  16895,  15360,  13824,  12288,  10752,   9216,   7680,   6144,   4608,   3072,   1536,
+         0,  -1536,  -3072,  -4608,  -6144,  -7680,  -9216, -10752, -12288, -13824, -15360, -16895, -18431, -19967, -21503, -23039,
+    -24575, -26111, -27647, -29183, -30719, -32255, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32255, -30719, -29183, -27647, -26111,
+    -24575, -23039, -21503, -19967, -18431, -16895, -15360, -13824, -12288, -10752,  -9216,  -7680,  -6144,  -4608,  -3072,  -1536,
+};
+
+// One period of a square wave, starting at zero and rising, as signed Q15
+static const int16_t audio_mixer_wavetable_square[AUDIO_MIXER_WAVETABLE_SIZE] = {
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+     32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,  32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+    -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767, -32767,
+};
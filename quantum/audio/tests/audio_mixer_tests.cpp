@@ -0,0 +1,309 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "audio_mixer.h"
+#include "audio_mixer_wavetables.h"
+#include "musical_notes.h"
+}
+
+// The DAC mixer driver's rate with the default DAC sample rate
+#define SAMPLE_RATE 33075
+#define CENTER (AUDIO_MIXER_SAMPLE_MAX / 2)
+#define GAIN_MAX 32767
+#define RAMP_STEP (GAIN_MAX / AUDIO_MIXER_RAMP_SAMPLES)
+
+// The parts of the audio core followed by audio_mixer_task
+static std::vector<float> core_tones;
+static bool               core_changed;
+
+extern "C" {
+bool audio_update_state(void) {
+    bool changed = core_changed;
+    core_changed = false;
+    return changed;
+}
+
+uint8_t audio_get_number_of_active_tones(void) {
+    return core_tones.size();
+}
+
+float audio_get_processed_frequency(uint8_t tone_index) {
+    return tone_index < core_tones.size() ? core_tones[tone_index] : 0.0f;
+}
+
+bool audio_is_playing_note(void) {
+    return !core_tones.empty();
+}
+
+bool audio_is_playing_melody(void) {
+    return false;
+}
+}
+
+// A sine voice in double precision, with the gain following the same linear ramp
+struct ReferenceVoice {
+    double  frequency;
+    double  phase;
+    int32_t gain;
+    int32_t target;
+
+    double next(void) {
+        gain         = gain < target ? std::min(gain + RAMP_STEP, target) : std::max(gain - RAMP_STEP, target);
+        double value = std::sin(2 * M_PI * phase) * gain / GAIN_MAX;
+        phase += frequency / SAMPLE_RATE;
+        return value;
+    }
+};
+
+static std::vector<audio_mixer_sample_t> reference(std::vector<ReferenceVoice>& voices, size_t count) {
+    std::vector<audio_mixer_sample_t> samples(count);
+    for (size_t s = 0; s < count; s++) {
+        double mix = 0;
+        for (ReferenceVoice& voice : voices) {
+            mix += voice.next();
+        }
+        samples[s] = std::lround(CENTER + mix * CENTER);
+    }
+    return samples;
+}
+
+static std::vector<audio_mixer_sample_t> render(size_t count) {
+    std::vector<audio_mixer_sample_t> samples(count);
+    audio_mixer_render(samples.data(), count);
+    return samples;
+}
+
+static void expect_near(const std::vector<audio_mixer_sample_t>& actual, const std::vector<audio_mixer_sample_t>& expected, int tolerance) {
+    ASSERT_EQ(actual.size(), expected.size());
+    for (size_t s = 0; s < actual.size(); s++) {
+        ASSERT_LE(std::abs(actual[s] - expected[s]), tolerance) << "sample " << s << ": got " << actual[s] << " expected " << expected[s];
+    }
+}
+
+class AudioMixer : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        core_tones.clear();
+        core_changed = false;
+        audio_mixer_init(SAMPLE_RATE);
+        audio_mixer_set_waveform(AUDIO_MIXER_WAVEFORM_SINE);
+    }
+
+    static void set_tones(std::vector<float> tones) {
+        audio_mixer_set_tones(tones.data(), tones.size());
+    }
+};
+
+TEST_F(AudioMixer, SineMatchesReference) {
+    set_tones({440.0f});
+    std::vector<ReferenceVoice> voices = {{440.0, 0, 0, GAIN_MAX}};
+    expect_near(render(4096), reference(voices, 4096), 2);
+}
+
+TEST_F(AudioMixer, ChordMatchesReference) {
+    set_tones({NOTE_C5, NOTE_E5, NOTE_G5});
+    std::vector<ReferenceVoice> voices = {
+        {NOTE_C5, 0, 0, GAIN_MAX / 3},
+        {NOTE_E5, 0, 0, GAIN_MAX / 3},
+        {NOTE_G5, 0, 0, GAIN_MAX / 3},
+    };
+    expect_near(render(4096), reference(voices, 4096), 3);
+}
+
+TEST_F(AudioMixer, KeptTonesKeepTheirPhase) {
+    set_tones({440.0f});
+    std::vector<ReferenceVoice> voices = {{440.0, 0, 0, GAIN_MAX}};
+    expect_near(render(1000), reference(voices, 1000), 2);
+
+    // The first voice carries on at half the gain while the new one fades in from zero
+    set_tones({660.0f, 440.0f});
+    voices[0].target = GAIN_MAX / 2;
+    voices.push_back({660.0, 0, 0, GAIN_MAX / 2});
+    expect_near(render(1000), reference(voices, 1000), 3);
+
+    // Removing a tone fades it out, the other one takes the whole range again
+    set_tones({660.0f});
+    voices[0].target = 0;
+    voices[1].target = GAIN_MAX;
+    expect_near(render(1000), reference(voices, 1000), 3);
+}
+
+TEST_F(AudioMixer, SoundingVoicesAreRetuned) {
+    set_tones({440.0f});
+    std::vector<ReferenceVoice> voices = {{440.0, 0, 0, GAIN_MAX}};
+    expect_near(render(500), reference(voices, 500), 2);
+
+    // As with vibrato, the phase runs on at the new frequency
+    set_tones({445.0f});
+    voices[0].frequency = 445.0;
+    expect_near(render(500), reference(voices, 500), 2);
+}
+
+TEST_F(AudioMixer, RestsAndExtraTonesAreIgnored) {
+    set_tones({0.0f, 440.0f, 0.0f});
+    std::vector<ReferenceVoice> voices = {{440.0, 0, 0, GAIN_MAX}};
+    expect_near(render(512), reference(voices, 512), 2);
+
+    std::vector<float> tones;
+    for (int i = 0; i < AUDIO_MIXER_VOICES + 2; i++) {
+        tones.push_back(200.0f + i * 100.0f);
+    }
+    audio_mixer_set_tones(tones.data(), tones.size());
+    for (audio_mixer_sample_t sample : render(4096)) {
+        ASSERT_LE(sample, AUDIO_MIXER_SAMPLE_MAX);
+    }
+}
+
+TEST_F(AudioMixer, BlocksMatchContinuousRender) {
+    set_tones({NOTE_A4, NOTE_CS5});
+    std::vector<audio_mixer_sample_t> continuous = render(AUDIO_MIXER_BLOCK_SIZE * 10);
+
+    audio_mixer_init(SAMPLE_RATE);
+    set_tones({NOTE_A4, NOTE_CS5});
+    std::vector<audio_mixer_sample_t> blocks;
+    while (blocks.size() < continuous.size()) {
+        // The output drains one block for every block rendered
+        EXPECT_GE(audio_mixer_fill(), 1);
+        const audio_mixer_sample_t* block = audio_mixer_read_block();
+        ASSERT_NE(block, nullptr);
+        blocks.insert(blocks.end(), block, block + AUDIO_MIXER_BLOCK_SIZE);
+    }
+    EXPECT_EQ(blocks, continuous);
+    EXPECT_EQ(audio_mixer_get_underruns(), 0);
+}
+
+TEST_F(AudioMixer, FillStopsWhenRingIsFull) {
+    set_tones({440.0f});
+    EXPECT_EQ(audio_mixer_fill(), AUDIO_MIXER_BLOCK_COUNT);
+    EXPECT_EQ(audio_mixer_fill(), 0);
+    EXPECT_NE(audio_mixer_read_block(), nullptr);
+    EXPECT_EQ(audio_mixer_fill(), 1);
+}
+
+TEST_F(AudioMixer, SilentMixerRendersNothing) {
+    EXPECT_TRUE(audio_mixer_is_idle());
+    EXPECT_EQ(audio_mixer_fill(), 0);
+    EXPECT_EQ(audio_mixer_read_block(), nullptr);
+    // Running dry while nothing plays is not an underrun
+    EXPECT_EQ(audio_mixer_get_underruns(), 0);
+    EXPECT_EQ(audio_mixer_time_until_next(), UINT32_MAX);
+}
+
+TEST_F(AudioMixer, UnderrunIsCounted) {
+    set_tones({440.0f});
+    EXPECT_EQ(audio_mixer_read_block(), nullptr);
+    EXPECT_EQ(audio_mixer_get_underruns(), 1);
+    EXPECT_FALSE(audio_mixer_is_idle());
+}
+
+TEST_F(AudioMixer, StoppedTonesFadeOutToCenter) {
+    set_tones({440.0f, 880.0f});
+    audio_mixer_fill();
+    while (audio_mixer_read_block()) {
+    }
+
+    set_tones({});
+    audio_mixer_fill();
+    const audio_mixer_sample_t* block;
+    const audio_mixer_sample_t* last = nullptr;
+    int                         count = 0;
+    while ((block = audio_mixer_read_block()) != nullptr) {
+        last = block;
+        count++;
+    }
+    // The fade out fits in a single block, after which nothing more is rendered
+    EXPECT_EQ(count, (AUDIO_MIXER_RAMP_SAMPLES + AUDIO_MIXER_BLOCK_SIZE - 1) / AUDIO_MIXER_BLOCK_SIZE);
+    ASSERT_NE(last, nullptr);
+    EXPECT_EQ(last[AUDIO_MIXER_BLOCK_SIZE - 1], CENTER);
+    EXPECT_TRUE(audio_mixer_is_idle());
+    EXPECT_EQ(audio_mixer_fill(), 0);
+}
+
+TEST_F(AudioMixer, WaveformsStayInRange) {
+    for (int waveform = 0; waveform < AUDIO_MIXER_WAVEFORM_COUNT; waveform++) {
+        audio_mixer_init(SAMPLE_RATE);
+        audio_mixer_set_waveform(static_cast<audio_mixer_waveform_t>(waveform));
+        set_tones({NOTE_C4, NOTE_G4});
+        std::vector<audio_mixer_sample_t> samples = render(4096);
+        auto [low, high]                          = std::minmax_element(samples.begin(), samples.end());
+        EXPECT_LE(*high, AUDIO_MIXER_SAMPLE_MAX) << "waveform " << waveform;
+        // Both voices add up to most of the range at some point
+        EXPECT_GT(*high - *low, AUDIO_MIXER_SAMPLE_MAX / 2) << "waveform " << waveform;
+    }
+}
+
+TEST_F(AudioMixer, TaskFollowsAudioCore) {
+    EXPECT_EQ(audio_mixer_time_until_next(), UINT32_MAX);
+
+    core_tones   = {440.0f};
+    core_changed = true;
+    audio_mixer_task();
+    EXPECT_EQ(audio_mixer_time_until_next(), 0);
+
+    std::vector<ReferenceVoice>       voices = {{440.0, 0, 0, GAIN_MAX}};
+    std::vector<audio_mixer_sample_t> expected = reference(voices, AUDIO_MIXER_BLOCK_SIZE * AUDIO_MIXER_BLOCK_COUNT);
+    for (int i = 0; i < AUDIO_MIXER_BLOCK_COUNT; i++) {
+        const audio_mixer_sample_t* block = audio_mixer_read_block();
+        ASSERT_NE(block, nullptr);
+        expect_near(std::vector<audio_mixer_sample_t>(block, block + AUDIO_MIXER_BLOCK_SIZE), std::vector<audio_mixer_sample_t>(expected.begin() + i * AUDIO_MIXER_BLOCK_SIZE, expected.begin() + (i + 1) * AUDIO_MIXER_BLOCK_SIZE), 2);
+    }
+
+    // The last tone stopping is picked up even though the core no longer reports a change
+    core_tones.clear();
+    for (int i = 0; i < 8; i++) {
+        audio_mixer_task();
+        while (audio_mixer_read_block()) {
+        }
+    }
+    EXPECT_TRUE(audio_mixer_is_idle());
+    EXPECT_EQ(audio_mixer_time_until_next(), UINT32_MAX);
+}
+
+/*
+ * Reports the time taken to render a second of audio with every voice playing, against the
+ * per sample floating point synthesis of the additive DAC driver.
+ */
+TEST_F(AudioMixer, RenderSpeed) {
+    std::vector<float> tones;
+    for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+        tones.push_back(NOTE_C4 * (1.0f + i * 0.25f));
+    }
+    audio_mixer_set_tones(tones.data(), tones.size());
+    std::vector<audio_mixer_sample_t> samples(AUDIO_MIXER_BLOCK_SIZE);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < SAMPLE_RATE / AUDIO_MIXER_BLOCK_SIZE; i++) {
+        audio_mixer_render(samples.data(), AUDIO_MIXER_BLOCK_SIZE);
+    }
+    std::chrono::duration<double, std::nano> mixer = std::chrono::steady_clock::now() - start;
+
+    // The additive driver's dac_value_generate, one call per sample
+    std::vector<float>     phases(AUDIO_MIXER_VOICES);
+    volatile uint_fast16_t sink;
+    start = std::chrono::steady_clock::now();
+    for (int s = 0; s < SAMPLE_RATE / AUDIO_MIXER_BLOCK_SIZE * AUDIO_MIXER_BLOCK_SIZE; s++) {
+        uint_fast16_t value = 0;
+        for (int i = 0; i < AUDIO_MIXER_VOICES; i++) {
+            float phase = phases[i] + tones[i] * (256.0f / SAMPLE_RATE);
+            while (phase >= 256.0f)
+                phase -= 256.0f;
+            phases[i] = phase;
+            value += (uint16_t)((audio_mixer_wavetable_sine[(size_t)phase] + 32768) >> 4) / AUDIO_MIXER_VOICES;
+        }
+        sink = value;
+    }
+    (void)sink;
+    std::chrono::duration<double, std::nano> additive = std::chrono::steady_clock::now() - start;
+
+    int samples_rendered = SAMPLE_RATE / AUDIO_MIXER_BLOCK_SIZE * AUDIO_MIXER_BLOCK_SIZE;
+    std::printf("audio_mixer: %d voices, %5.2f ns/sample mixed, %5.2f ns/sample per sample float synthesis\n", AUDIO_MIXER_VOICES, mixer.count() / samples_rendered, additive.count() / samples_rendered);
+}
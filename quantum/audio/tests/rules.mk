@@ -0,0 +1,6 @@
+audio_mixer_DEFS := -DAUDIO_MIXER_VOICES=4 -DAUDIO_MIXER_BLOCK_SIZE=64 -DAUDIO_MIXER_BLOCK_COUNT=4
+audio_mixer_INC := $(QUANTUM_PATH)/audio
+
+audio_mixer_SRC := \
+	$(QUANTUM_PATH)/audio/tests/audio_mixer_tests.cpp \
+	$(QUANTUM_PATH)/audio/audio_mixer.c
@@ -19,17 +19,13 @@
         PROFILE_CALL_NAMED(1000, "matrix_task", {
             matrix_task();
         });
+
+    For statistics that are kept per call site and can be read back over raw HID, see profiling.h.
 */
 
-#if defined(PROTOCOL_LUFA) || defined(PROTOCOL_VUSB)
-#    define TIMESTAMP_GETTER TCNT0
-#elif defined(PROTOCOL_CHIBIOS)
-#    define TIMESTAMP_GETTER chSysGetRealtimeCounterX()
-#elif defined(PROTOCOL_ARM_ATSAM)
-#    error arm_atsam not currently supported
-#else
-#    error Unknown protocol in use
-#endif
+#include "timer.h"
+
+#define TIMESTAMP_GETTER timer_read_cycles()
 
 #ifndef CONSOLE_ENABLE
 // Can't do anything if we don't have console output enabled.
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifndef CAPS_WORD_IDLE_TIMEOUT
 #    define CAPS_WORD_IDLE_TIMEOUT 5000 // Default timeout of 5 seconds.
@@ -23,6 +24,9 @@
 /** @brief Matrix scan task for Caps Word feature */
 void caps_word_task(void);
 
+/** @brief Milliseconds until Caps Word times out, or TIMER_NO_DEADLINE if it can't. */
+uint32_t caps_word_time_until_next(void);
+
 #if CAPS_WORD_IDLE_TIMEOUT > 0
 /** @brief Resets timer for Caps Word idle timeout. */
 void caps_word_reset_idle_timer(void);
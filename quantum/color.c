@@ -19,82 +19,50 @@
 #include "progmem.h"
 #include "util.h"
 
-RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
-    RGB      rgb;
-    uint8_t  region, remainder, p, q, t;
-    uint16_t h, s, v;
+// Order of the v, t, p and q components in red, green and blue for each hue region
+static const uint8_t PROGMEM hsv_region_order[7][3] = {
+    {0, 1, 2}, {3, 0, 2}, {2, 0, 1}, {2, 3, 0}, {1, 2, 0}, {0, 2, 3}, {0, 1, 2},
+};
 
-    if (hsv.s == 0) {
-#ifdef USE_CIE1931_CURVE
-        if (use_cie) {
-            rgb.r = rgb.g = rgb.b = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-        } else {
-            rgb.r = hsv.v;
-            rgb.g = hsv.v;
-            rgb.b = hsv.v;
-        }
-#else
-        rgb.r = hsv.v;
-        rgb.g = hsv.v;
-        rgb.b = hsv.v;
-#endif
-        return rgb;
-    }
+__attribute__((always_inline)) static inline RGB hsv_to_rgb_fixed(uint8_t h, uint8_t s, uint8_t v) {
+    RGB     rgb;
+    uint8_t components[4];
 
-    h = hsv.h;
-    s = hsv.s;
-#ifdef USE_CIE1931_CURVE
-    if (use_cie) {
-        v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
-    } else {
-        v = hsv.v;
-    }
+    // h * 6 / 255 and its position within the region, without a division
+    uint16_t h6        = h * 6;
+    uint8_t  region    = (h6 + 1 + (h6 >> 8)) >> 8;
+    uint8_t  remainder = (h * 2 - region * 85) * 3;
+
+    components[0] = v;
+    components[2] = (v * (255 - s)) >> 8;
+#if defined(__AVR__)
+    components[3] = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    components[1] = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
 #else
-    v = hsv.v;
+    // q and t in the two 16 bit halves of a register, no product exceeds 255 * 255
+    uint32_t lanes = remainder | (uint32_t)(255 - remainder) << 16;
+    lanes          = 0x00FF00FF - ((s * lanes >> 8) & 0x00FF00FF);
+    lanes          = (v * lanes >> 8) & 0x00FF00FF;
+    components[3]  = lanes;
+    components[1]  = lanes >> 16;
 #endif
 
-    region    = h * 6 / 255;
-    remainder = (h * 2 - region * 85) * 3;
+    // Grey has every component equal to v
+    uint8_t grey = -(s == 0);
 
-    p = (v * (255 - s)) >> 8;
-    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
-    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+    rgb.r = (components[pgm_read_byte(&hsv_region_order[region][0])] & ~grey) | (v & grey);
+    rgb.g = (components[pgm_read_byte(&hsv_region_order[region][1])] & ~grey) | (v & grey);
+    rgb.b = (components[pgm_read_byte(&hsv_region_order[region][2])] & ~grey) | (v & grey);
+    return rgb;
+}
 
-    switch (region) {
-        case 6:
-        case 0:
-            rgb.r = v;
-            rgb.g = t;
-            rgb.b = p;
-            break;
-        case 1:
-            rgb.r = q;
-            rgb.g = v;
-            rgb.b = p;
-            break;
-        case 2:
-            rgb.r = p;
-            rgb.g = v;
-            rgb.b = t;
-            break;
-        case 3:
-            rgb.r = p;
-            rgb.g = q;
-            rgb.b = v;
-            break;
-        case 4:
-            rgb.r = t;
-            rgb.g = p;
-            rgb.b = v;
-            break;
-        default:
-            rgb.r = v;
-            rgb.g = p;
-            rgb.b = q;
-            break;
+RGB hsv_to_rgb_impl(HSV hsv, bool use_cie) {
+#ifdef USE_CIE1931_CURVE
+    if (use_cie) {
+        hsv.v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
     }
-
-    return rgb;
+#endif
+    return hsv_to_rgb_fixed(hsv.h, hsv.s, hsv.v);
 }
 
 RGB hsv_to_rgb(HSV hsv) {
@@ -109,6 +77,17 @@ RGB hsv_to_rgb_nocie(HSV hsv) {
     return hsv_to_rgb_impl(hsv, false);
 }
 
+void hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint16_t count) {
+    for (uint16_t i = 0; i < count; i++) {
+#ifdef USE_CIE1931_CURVE
+        uint8_t v = pgm_read_byte(&CIE1931_CURVE[hsv[i].v]);
+#else
+        uint8_t v = hsv[i].v;
+#endif
+        rgb[i] = hsv_to_rgb_fixed(hsv[i].h, hsv[i].s, v);
+    }
+}
+
 #ifdef WS2812_RGBW
 void convert_rgb_to_rgbw(rgb_led_t *led) {
     // Determine lowest value in all three colors, put that into
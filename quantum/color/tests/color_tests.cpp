@@ -0,0 +1,144 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "color.h"
+#include "led_tables.h"
+#include "progmem.h"
+}
+
+// The conversion as it was written before the fixed point core, one branch per hue region
+static RGB reference_hsv_to_rgb(HSV hsv) {
+    RGB      rgb;
+    uint8_t  region, remainder, p, q, t;
+    uint16_t h, s, v;
+
+#ifdef USE_CIE1931_CURVE
+    hsv.v = pgm_read_byte(&CIE1931_CURVE[hsv.v]);
+#endif
+    if (hsv.s == 0) {
+        rgb.r = rgb.g = rgb.b = hsv.v;
+        return rgb;
+    }
+
+    h = hsv.h;
+    s = hsv.s;
+    v = hsv.v;
+
+    region    = h * 6 / 255;
+    remainder = (h * 2 - region * 85) * 3;
+
+    p = (v * (255 - s)) >> 8;
+    q = (v * (255 - ((s * remainder) >> 8))) >> 8;
+    t = (v * (255 - ((s * (255 - remainder)) >> 8))) >> 8;
+
+    switch (region) {
+        case 6:
+        case 0:
+            rgb.r = v, rgb.g = t, rgb.b = p;
+            break;
+        case 1:
+            rgb.r = q, rgb.g = v, rgb.b = p;
+            break;
+        case 2:
+            rgb.r = p, rgb.g = v, rgb.b = t;
+            break;
+        case 3:
+            rgb.r = p, rgb.g = q, rgb.b = v;
+            break;
+        case 4:
+            rgb.r = t, rgb.g = p, rgb.b = v;
+            break;
+        default:
+            rgb.r = v, rgb.g = p, rgb.b = q;
+            break;
+    }
+    return rgb;
+}
+
+static std::vector<HSV> all_colors(void) {
+    std::vector<HSV> colors;
+    colors.reserve(1 << 24);
+    for (uint32_t i = 0; i < (1 << 24); i++) {
+        colors.push_back({static_cast<uint8_t>(i >> 16), static_cast<uint8_t>(i >> 8), static_cast<uint8_t>(i)});
+    }
+    return colors;
+}
+
+#define EXPECT_RGB_EQ(actual, expected, hsv)                                                         \
+    ASSERT_TRUE(actual.r == expected.r && actual.g == expected.g && actual.b == expected.b)          \
+        << "hsv " << +hsv.h << "," << +hsv.s << "," << +hsv.v << ": got " << +actual.r << "," << +actual.g << "," << +actual.b \
+        << " expected " << +expected.r << "," << +expected.g << "," << +expected.b
+
+TEST(Color, MatchesReferenceForEveryColor) {
+    for (const HSV& hsv : all_colors()) {
+        RGB actual   = hsv_to_rgb(hsv);
+        RGB expected = reference_hsv_to_rgb(hsv);
+        EXPECT_RGB_EQ(actual, expected, hsv);
+    }
+}
+
+TEST(Color, BatchMatchesSingleConversion) {
+    std::vector<HSV> colors = all_colors();
+    std::vector<RGB> batch(colors.size());
+
+    // In frame sized chunks, as the LED drivers use it
+    for (size_t i = 0; i < colors.size(); i += 256) {
+        hsv_to_rgb_batch(&colors[i], &batch[i], 256);
+    }
+    for (size_t i = 0; i < colors.size(); i++) {
+        RGB expected = hsv_to_rgb(colors[i]);
+        EXPECT_RGB_EQ(batch[i], expected, colors[i]);
+    }
+}
+
+TEST(Color, BatchOfNothing) {
+    HSV hsv = {1, 2, 3};
+    RGB rgb;
+    rgb.r = 4, rgb.g = 5, rgb.b = 6;
+    hsv_to_rgb_batch(&hsv, &rgb, 0);
+    EXPECT_EQ(rgb.r, 4);
+    EXPECT_EQ(rgb.g, 5);
+    EXPECT_EQ(rgb.b, 6);
+}
+
+/*
+ * Reports the time taken to convert every color with the reference code, one call per color
+ * and the batch conversion. The colors are shuffled, as neighbouring LEDs rarely share a hue
+ * region.
+ */
+TEST(Color, ConversionSpeed) {
+    std::vector<HSV> colors = all_colors();
+    std::vector<RGB> rgb(colors.size());
+    std::shuffle(colors.begin(), colors.end(), std::mt19937(1234));
+
+    auto measure = [&](const char* name, auto convert) {
+        auto start = std::chrono::steady_clock::now();
+        convert();
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        std::printf("color: %-10s %5.2f ns/color\n", name, elapsed.count() / colors.size());
+    };
+
+    measure("reference", [&] {
+        for (size_t i = 0; i < colors.size(); i++) {
+            rgb[i] = reference_hsv_to_rgb(colors[i]);
+        }
+    });
+    measure("single", [&] {
+        for (size_t i = 0; i < colors.size(); i++) {
+            rgb[i] = hsv_to_rgb(colors[i]);
+        }
+    });
+    measure("batch", [&] {
+        for (size_t i = 0; i < colors.size(); i += 256) {
+            hsv_to_rgb_batch(&colors[i], &rgb[i], 256);
+        }
+    });
+}
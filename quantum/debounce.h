@@ -18,4 +18,11 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 
 void debounce_init(uint8_t num_rows);
 
+/**
+ * @brief Time until the debounce algorithm needs to be called again.
+ *
+ * @return 0 while a change is being debounced, or TIMER_NO_DEADLINE when the cooked matrix is settled
+ */
+uint32_t debounce_time_until_next(void);
+
 void debounce_free(void);
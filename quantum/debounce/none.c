@@ -15,6 +15,7 @@
  */
 
 #include "debounce.h"
+#include "timer.h"
 #include <string.h>
 
 void debounce_init(uint8_t num_rows) {}
@@ -33,4 +34,8 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     return cooked_changed;
 }
 
+uint32_t debounce_time_until_next(void) {
+    return TIMER_NO_DEADLINE;
+}
+
 void debounce_free(void) {}
@@ -54,6 +54,14 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     return cooked_changed;
 }
 
+uint32_t debounce_time_until_next(void) {
+    if (!debouncing) {
+        return TIMER_NO_DEADLINE;
+    }
+    fast_timer_t elapsed = timer_elapsed_fast(debouncing_time);
+    return elapsed >= DEBOUNCE ? 0 : DEBOUNCE - elapsed;
+}
+
 void debounce_free(void) {}
 #else // no debouncing.
 #    include "none.c"
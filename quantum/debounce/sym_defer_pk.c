@@ -70,6 +70,10 @@ void debounce_free(void) {
     debounce_counters = NULL;
 }
 
+uint32_t debounce_time_until_next(void) {
+    return (counters_need_update) ? 0 : TIMER_NO_DEADLINE;
+}
+
 bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
     bool updated_last = false;
     cooked_changed    = false;
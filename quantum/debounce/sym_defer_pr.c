@@ -30,6 +30,8 @@ static uint16_t last_time;
 static uint8_t* countdowns;
 // [row]
 static matrix_row_t* last_raw;
+// Whether any row is still counting down.
+static bool counting;
 
 void debounce_init(uint8_t num_rows) {
     countdowns = (uint8_t*)calloc(num_rows, sizeof(uint8_t));
@@ -53,6 +55,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
     bool    cooked_changed = false;
 
     uint8_t* countdown = countdowns;
+    counting           = false;
 
     for (uint8_t row = 0; row < num_rows; ++row, ++countdown) {
         matrix_row_t raw_row = raw[row];
@@ -67,6 +70,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
             cooked[row] = raw_row;
             *countdown  = 0;
         }
+        counting |= *countdown != 0;
     }
 
     return cooked_changed;
@@ -75,3 +79,7 @@ bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool
 bool debounce_active(void) {
     return true;
 }
+
+uint32_t debounce_time_until_next(void) {
+    return counting ? 0 : TIMER_NO_DEADLINE;
+}
@@ -0,0 +1,166 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*
+Symmetric per-key algorithm using vertical counters. Behaves like sym_defer_pk: when no state
+changes have occured on a key for DEBOUNCE milliseconds, we push the state.
+
+Instead of a byte per key, bit i of every key's counter is kept in counters[i][row], so a whole
+row of counters is updated with a few bitwise operations per counter bit.
+*/
+
+#include "debounce.h"
+#include "timer.h"
+#include <string.h>
+
+#ifndef DEBOUNCE
+#    define DEBOUNCE 5
+#endif
+
+// Maximum debounce: 255ms
+#if DEBOUNCE > UINT8_MAX
+#    undef DEBOUNCE
+#    define DEBOUNCE UINT8_MAX
+#endif
+
+#if DEBOUNCE > 0
+
+// Number of bits needed to hold DEBOUNCE
+#    if DEBOUNCE < 2
+#        define COUNTER_BITS 1
+#    elif DEBOUNCE < 4
+#        define COUNTER_BITS 2
+#    elif DEBOUNCE < 8
+#        define COUNTER_BITS 3
+#    elif DEBOUNCE < 16
+#        define COUNTER_BITS 4
+#    elif DEBOUNCE < 32
+#        define COUNTER_BITS 5
+#    elif DEBOUNCE < 64
+#        define COUNTER_BITS 6
+#    elif DEBOUNCE < 128
+#        define COUNTER_BITS 7
+#    else
+#        define COUNTER_BITS 8
+#    endif
+
+// Milliseconds left per key, zero when the key is not debouncing
+static matrix_row_t counters[COUNTER_BITS][MATRIX_ROWS];
+static fast_timer_t last_time;
+static bool         counters_need_update;
+static bool         cooked_changed;
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time);
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows);
+
+// we use num_rows rather than MATRIX_ROWS to support split keyboards
+void debounce_init(uint8_t num_rows) {
+    memset(counters, 0, sizeof(counters));
+    counters_need_update = false;
+}
+
+void debounce_free(void) {}
+
+uint32_t debounce_time_until_next(void) {
+    return counters_need_update ? 0 : TIMER_NO_DEADLINE;
+}
+
+bool debounce(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, bool changed) {
+    bool updated_last = false;
+    cooked_changed    = false;
+
+    if (counters_need_update) {
+        fast_timer_t now          = timer_read_fast();
+        fast_timer_t elapsed_time = TIMER_DIFF_FAST(now, last_time);
+
+        last_time    = now;
+        updated_last = true;
+        // Every counter has expired after DEBOUNCE, which also keeps the subtraction within COUNTER_BITS
+        if (elapsed_time > DEBOUNCE) {
+            elapsed_time = DEBOUNCE;
+        }
+
+        if (elapsed_time > 0) {
+            update_debounce_counters_and_transfer_if_expired(raw, cooked, num_rows, elapsed_time);
+        }
+    }
+
+    if (changed) {
+        if (!updated_last) {
+            last_time = timer_read_fast();
+        }
+
+        start_debounce_counters(raw, cooked, num_rows);
+    }
+
+    return cooked_changed;
+}
+
+static void update_debounce_counters_and_transfer_if_expired(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows, uint8_t elapsed_time) {
+    counters_need_update = false;
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t active = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            active |= counters[bit][row];
+        }
+        if (!active) {
+            continue;
+        }
+
+        // Subtract elapsed_time from every active counter in the row, bit by bit
+        matrix_row_t borrow    = 0;
+        matrix_row_t remaining = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            matrix_row_t counter    = counters[bit][row];
+            matrix_row_t subtrahend = (elapsed_time & (1 << bit)) ? active : 0;
+            matrix_row_t difference = counter ^ subtrahend ^ borrow;
+
+            borrow             = (~counter & subtrahend) | (~(counter ^ subtrahend) & borrow);
+            counters[bit][row] = difference;
+            remaining |= difference;
+        }
+
+        // Counters that reached zero or went below it have expired
+        matrix_row_t expired = active & (borrow | ~remaining);
+        if (expired) {
+            for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+                counters[bit][row] &= ~expired;
+            }
+            matrix_row_t cooked_next = (cooked[row] & ~expired) | (raw[row] & expired);
+            cooked_changed |= cooked[row] ^ cooked_next;
+            cooked[row] = cooked_next;
+        }
+        if (active & ~expired) {
+            counters_need_update = true;
+        }
+    }
+}
+
+static void start_debounce_counters(matrix_row_t raw[], matrix_row_t cooked[], uint8_t num_rows) {
+    for (uint8_t row = 0; row < num_rows; row++) {
+        matrix_row_t delta  = raw[row] ^ cooked[row];
+        matrix_row_t active = 0;
+        for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+            // Keys that went back to their debounced state stop debouncing
+            counters[bit][row] &= delta;
+            active |= counters[bit][row];
+        }
+
+        // Keys that just started to differ count down from DEBOUNCE
+        matrix_row_t started = delta & ~active;
+        if (started) {
+            for (uint8_t bit = 0; bit < COUNTER_BITS; bit++) {
+                if (DEBOUNCE & (1 << bit)) {
+                    counters[bit][row] |= started;
+                }
+            }
+        }
+        if (delta) {
+            counters_need_update = true;
+        }
+    }
+}
+
+#else
+#    include "none.c"
+#endif
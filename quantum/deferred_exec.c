@@ -9,34 +9,114 @@
 #    define MAX_DEFERRED_EXECUTORS 8
 #endif
 
+_Static_assert(MAX_DEFERRED_EXECUTORS <= DEFERRED_EXEC_MAX_TABLE_SIZE, "MAX_DEFERRED_EXECUTORS is too large");
+
 //------------------------------------
 // Helpers
 //
+// Each table is kept as a binary min-heap ordered by trigger time, laid out across the table entries themselves so that
+// zero-initialised tables are valid and empty:
+//   - table[pos].heap_slot holds 1 + the slot index stored at heap position pos, or 0 if that position is unused.
+//     Used positions are always a contiguous run starting at position 0.
+//   - table[slot].heap_pos holds the heap position of an in-use slot.
+// Slots themselves never move, and the low byte of each token is 1 + its slot index, so token lookups are O(1).
+//
 
-static deferred_token current_token = 0;
+static uint8_t current_generation = 0;
 
-static inline bool token_can_be_used(deferred_executor_t *table, size_t table_count, deferred_token token) {
-    if (token == INVALID_DEFERRED_TOKEN) {
-        return false;
+static inline int32_t trigger_diff(deferred_executor_t *table, uint8_t slot_a, uint8_t slot_b) {
+    return (int32_t)TIMER_DIFF_32(table[slot_a].trigger_time, table[slot_b].trigger_time);
+}
+
+static inline deferred_executor_t *entry_for_token(deferred_executor_t *table, size_t table_count, deferred_token token) {
+    uint8_t slot = (uint8_t)(token & 0xFF) - 1;
+    if (token == INVALID_DEFERRED_TOKEN || slot >= table_count || table[slot].token != token) {
+        return NULL;
     }
-    for (int i = 0; i < table_count; ++i) {
-        if (table[i].token == token) {
-            return false;
+    return &table[slot];
+}
+
+static size_t heap_count(deferred_executor_t *table, size_t table_count) {
+    // Used positions form a prefix of the table, so binary search for the first unused one
+    size_t lo = 0, hi = table_count;
+    while (lo < hi) {
+        size_t mid = (lo + hi) / 2;
+        if (table[mid].heap_slot != 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
         }
     }
-    return true;
+    return lo;
+}
+
+static inline void heap_place(deferred_executor_t *table, size_t pos, uint8_t slot) {
+    table[pos].heap_slot = slot + 1;
+    table[slot].heap_pos = pos;
 }
 
-static inline deferred_token allocate_token(deferred_executor_t *table, size_t table_count) {
-    deferred_token first = ++current_token;
-    while (!token_can_be_used(table, table_count, current_token)) {
-        ++current_token;
-        if (current_token == first) {
-            // If we've looped back around to the first, everything is already allocated (yikes!). Need to exit with a failure.
-            return INVALID_DEFERRED_TOKEN;
+static void heap_sift_up(deferred_executor_t *table, size_t pos) {
+    uint8_t slot = table[pos].heap_slot - 1;
+    while (pos > 0) {
+        size_t  parent      = (pos - 1) / 2;
+        uint8_t parent_slot = table[parent].heap_slot - 1;
+        if (trigger_diff(table, slot, parent_slot) >= 0) {
+            break;
         }
+        heap_place(table, pos, parent_slot);
+        pos = parent;
     }
-    return current_token;
+    heap_place(table, pos, slot);
+}
+
+static void heap_sift_down(deferred_executor_t *table, size_t count, size_t pos) {
+    uint8_t slot = table[pos].heap_slot - 1;
+    while (true) {
+        size_t child = pos * 2 + 1;
+        if (child >= count) {
+            break;
+        }
+        uint8_t child_slot = table[child].heap_slot - 1;
+        if (child + 1 < count && trigger_diff(table, table[child + 1].heap_slot - 1, child_slot) < 0) {
+            ++child;
+            child_slot = table[child].heap_slot - 1;
+        }
+        if (trigger_diff(table, child_slot, slot) >= 0) {
+            break;
+        }
+        heap_place(table, pos, child_slot);
+        pos = child;
+    }
+    heap_place(table, pos, slot);
+}
+
+static void heap_update(deferred_executor_t *table, size_t count, size_t pos) {
+    if (pos > 0 && trigger_diff(table, table[pos].heap_slot - 1, table[(pos - 1) / 2].heap_slot - 1) < 0) {
+        heap_sift_up(table, pos);
+    } else {
+        heap_sift_down(table, count, pos);
+    }
+}
+
+static void heap_remove(deferred_executor_t *table, size_t table_count, deferred_executor_t *entry) {
+    size_t count = heap_count(table, table_count);
+    size_t pos   = entry->heap_pos;
+    size_t last  = count - 1;
+
+    // Move the last heap element into the vacated position and restore ordering
+    if (pos != last) {
+        heap_place(table, pos, table[last].heap_slot - 1);
+        table[last].heap_slot = 0;
+        heap_update(table, last, pos);
+    } else {
+        table[last].heap_slot = 0;
+    }
+
+    entry->token        = INVALID_DEFERRED_TOKEN;
+    entry->heap_pos     = 0;
+    entry->trigger_time = 0;
+    entry->callback     = NULL;
+    entry->cb_arg       = NULL;
 }
 
 //------------------------------------
@@ -45,26 +125,26 @@ static inline deferred_token allocate_token(deferred_executor_t *table, size_t t
 
 deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_count, uint32_t delay_ms, deferred_exec_callback callback, void *cb_arg) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || !callback) {
+    if (!table || table_count == 0 || table_count > DEFERRED_EXEC_MAX_TABLE_SIZE || delay_ms == 0 || !callback) {
         return INVALID_DEFERRED_TOKEN;
     }
 
     // Find an unused slot and claim it
-    for (int i = 0; i < table_count; ++i) {
+    for (size_t i = 0; i < table_count; ++i) {
         deferred_executor_t *entry = &table[i];
         if (entry->token == INVALID_DEFERRED_TOKEN) {
-            // Work out the new token value, dropping out if none were available
-            deferred_token token = allocate_token(table, table_count);
-            if (token == INVALID_DEFERRED_TOKEN) {
-                return false;
-            }
+            // The generation in the upper byte guards against stale tokens matching a reused slot
+            deferred_token token = ((deferred_token)(++current_generation) << 8) | (i + 1);
 
-            // Set up the executor table entry
-            entry->token        = current_token;
+            // Set up the executor table entry and insert it into the heap
+            size_t count        = heap_count(table, table_count);
+            entry->token        = token;
             entry->trigger_time = timer_read32() + delay_ms;
             entry->callback     = callback;
             entry->cb_arg       = cb_arg;
-            return current_token;
+            heap_place(table, count, i);
+            heap_sift_up(table, count);
+            return token;
         }
     }
 
@@ -74,45 +154,44 @@ deferred_token defer_exec_advanced(deferred_executor_t *table, size_t table_coun
 
 bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token, uint32_t delay_ms) {
     // Ignore queueing if the table isn't valid, it's a zero-time delay, or the token is not valid
-    if (!table || table_count == 0 || delay_ms == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table_count == 0 || delay_ms == 0) {
         return false;
     }
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, extend the delay
-            entry->trigger_time = timer_read32() + delay_ms;
-            return true;
-        }
+    deferred_executor_t *entry = entry_for_token(table, table_count, token);
+    if (!entry) {
+        return false;
     }
 
-    // Not found
-    return false;
+    // Found it, extend the delay
+    entry->trigger_time = timer_read32() + delay_ms;
+    heap_update(table, heap_count(table, table_count), entry->heap_pos);
+    return true;
 }
 
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token) {
     // Ignore request if the table/token are not valid
-    if (!table || table_count == 0 || token == INVALID_DEFERRED_TOKEN) {
+    if (!table || table_count == 0) {
         return false;
     }
 
-    // Find the entry corresponding to the token
-    for (int i = 0; i < table_count; ++i) {
-        deferred_executor_t *entry = &table[i];
-        if (entry->token == token) {
-            // Found it, cancel and clear the table entry
-            entry->token        = INVALID_DEFERRED_TOKEN;
-            entry->trigger_time = 0;
-            entry->callback     = NULL;
-            entry->cb_arg       = NULL;
-            return true;
-        }
+    deferred_executor_t *entry = entry_for_token(table, table_count, token);
+    if (!entry) {
+        return false;
+    }
+
+    // Found it, cancel and clear the table entry
+    heap_remove(table, table_count, entry);
+    return true;
+}
+
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count) {
+    if (!table || table_count == 0 || table[0].heap_slot == 0) {
+        return TIMER_NO_DEADLINE;
     }
 
-    // Not found
-    return false;
+    int32_t remaining = (int32_t)TIMER_DIFF_32(table[table[0].heap_slot - 1].trigger_time, timer_read32());
+    return remaining > 0 ? (uint32_t)remaining : 0;
 }
 
 void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count, uint32_t *last_execution_time) {
@@ -122,35 +201,48 @@ void deferred_exec_advanced_task(deferred_executor_t *table, size_t table_count,
     if (((int32_t)TIMER_DIFF_32(now, (*last_execution_time))) > 0) {
         *last_execution_time = now;
 
-        // Run through each of the executors
-        for (int i = 0; i < table_count; ++i) {
-            deferred_executor_t *entry      = &table[i];
+        // Run through the executors which are due, earliest first. Bounded by the table size so that a callback
+        // which keeps rescheduling itself into the past can't stall the main loop.
+        bool     requeued_due = false;
+        uint32_t requeued_min = 0;
+        for (size_t i = 0; i < table_count && table[0].heap_slot != 0; ++i) {
+            deferred_executor_t *entry      = &table[table[0].heap_slot - 1];
             deferred_token       curr_token = entry->token;
 
-            // Check if we're supposed to execute this entry
-            if (curr_token != INVALID_DEFERRED_TOKEN && ((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0) {
-                // Invoke the callback and work work out if we should be requeued
-                uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
+            // Everything else in the heap is due later than the top entry
+            if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) > 0) {
+                break;
+            }
 
-                // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
-                if (entry->token != curr_token) {
-                    continue;
-                }
+            // Anything at or after the earliest executor re-queued into the past this pass may already have fired;
+            // leave it for the next pass so an overdue repeating executor only runs once per pass.
+            if (requeued_due && ((int32_t)TIMER_DIFF_32(entry->trigger_time, requeued_min)) >= 0) {
+                break;
+            }
+
+            // Invoke the callback and work work out if we should be requeued
+            uint32_t delay_ms = entry->callback(entry->trigger_time, entry->cb_arg);
 
-                // Update the trigger time if we have to repeat, otherwise clear it out
-                if (delay_ms > 0) {
-                    // Intentionally add just the delay to the existing trigger time -- this ensures the next
-                    // invocation is with respect to the previous trigger, rather than when it got to execution. Under
-                    // normal circumstances this won't cause issue, but if another executor is invoked that takes a
-                    // considerable length of time, then this ensures best-effort timing between invocations.
-                    entry->trigger_time += delay_ms;
-                } else {
-                    // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
-                    entry->token        = INVALID_DEFERRED_TOKEN;
-                    entry->trigger_time = 0;
-                    entry->callback     = NULL;
-                    entry->cb_arg       = NULL;
+            // If the token has changed, then the callback has canceled and re-queued. Skip further processing.
+            if (entry->token != curr_token) {
+                continue;
+            }
+
+            // Update the trigger time if we have to repeat, otherwise clear it out
+            if (delay_ms > 0) {
+                // Intentionally add just the delay to the existing trigger time -- this ensures the next
+                // invocation is with respect to the previous trigger, rather than when it got to execution. Under
+                // normal circumstances this won't cause issue, but if another executor is invoked that takes a
+                // considerable length of time, then this ensures best-effort timing between invocations.
+                entry->trigger_time += delay_ms;
+                heap_update(table, heap_count(table, table_count), entry->heap_pos);
+                if (((int32_t)TIMER_DIFF_32(entry->trigger_time, now)) <= 0 && (!requeued_due || ((int32_t)TIMER_DIFF_32(entry->trigger_time, requeued_min)) < 0)) {
+                    requeued_due = true;
+                    requeued_min = entry->trigger_time;
                 }
+            } else {
+                // If it was zero, then the callback is cancelling repeated execution. Free up the slot.
+                heap_remove(table, table_count, entry);
             }
         }
     }
@@ -172,6 +264,9 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms) {
 bool cancel_deferred_exec(deferred_token token) {
     return cancel_deferred_exec_advanced(basic_executors, MAX_DEFERRED_EXECUTORS, token);
 }
+uint32_t deferred_exec_time_until_next(void) {
+    return deferred_exec_advanced_time_until_next(basic_executors, MAX_DEFERRED_EXECUTORS);
+}
 void deferred_exec_task(void) {
     deferred_exec_advanced_task(basic_executors, MAX_DEFERRED_EXECUTORS, &last_deferred_exec_check);
 }
@@ -6,6 +6,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include "timer.h"
 
 //------------------------------------
 // Common
@@ -13,14 +14,22 @@
 
 /**
  * @typedef A token that can be used to cancel or extend an existing deferred execution.
+ *
+ * 16 bits wide: the low byte is the executor's slot, the high byte tells apart successive uses of that slot.
+ * Tokens stored in a narrower type no longer match their executor.
  */
-typedef uint8_t deferred_token;
+typedef uint16_t deferred_token;
 
 /**
  * @def The constant used to denote an invalid deferred execution token.
  */
 #define INVALID_DEFERRED_TOKEN 0
 
+/**
+ * @def The largest number of executors a single table may hold.
+ */
+#define DEFERRED_EXEC_MAX_TABLE_SIZE 255
+
 /**
  * @typedef Callback to execute.
  * @param trigger_time[in] the intended trigger time to execute the callback -- equivalent time-space as timer_read32()
@@ -60,6 +69,13 @@ bool extend_deferred_exec(deferred_token token, uint32_t delay_ms);
  */
 bool cancel_deferred_exec(deferred_token token);
 
+/**
+ * Queries how long until the next deferred execution is due.
+ *
+ * @return the number of milliseconds until the earliest pending executor is due, zero if one is overdue, or TIMER_NO_DEADLINE if none are pending
+ */
+uint32_t deferred_exec_time_until_next(void);
+
 /**
  * Forward declaration for the main loop in order to execute any deferred executors. Should not be invoked by keyboard/user code.
  */
@@ -73,9 +89,12 @@ void deferred_exec_task(void);
  * @struct Structure for containing self-hosted deferred executor tables.
  * @brief Core-side code can use this to create their own tables without impacting on the use of users' ability to add deferred execution.
  *        Code outside deferred_exec.c should not worry about internals of this struct, and should just allocate the required number in an array.
+ *        A table may hold at most DEFERRED_EXEC_MAX_TABLE_SIZE entries, and must be zero-initialised before first use.
  */
 typedef struct deferred_executor_t {
     deferred_token         token;
+    uint8_t                heap_pos;
+    uint8_t                heap_slot;
     uint32_t               trigger_time;
     deferred_exec_callback callback;
     void *                 cb_arg;
@@ -110,6 +129,15 @@ bool extend_deferred_exec_advanced(deferred_executor_t *table, size_t table_coun
  */
 bool cancel_deferred_exec_advanced(deferred_executor_t *table, size_t table_count, deferred_token token);
 
+/**
+ * Queries how long until the next deferred execution in a custom table is due.
+ *
+ * @param table[in] the custom table used for storage
+ * @param table_count[in] the number of available items in the table
+ * @return the number of milliseconds until the earliest pending executor is due, zero if one is overdue, or TIMER_NO_DEADLINE if none are pending
+ */
+uint32_t deferred_exec_advanced_time_until_next(deferred_executor_t *table, size_t table_count);
+
 /**
  * Forward declaration for the main loop in order to execute any custom table deferred executors. Should not be invoked by keyboard/user code.
  * Needed for any custom-allocated deferred execution tables. Any core tasks should add appropriate invocation to quantum/main.c.
@@ -0,0 +1,248 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "deferred_exec.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+}
+
+struct callback_log_t {
+    std::vector<uintptr_t> calls;
+    std::vector<uint32_t>  trigger_times;
+    uint32_t               repeat_ms;
+};
+
+static callback_log_t log_state;
+
+static uint32_t logging_callback(uint32_t trigger_time, void *cb_arg) {
+    log_state.calls.push_back((uintptr_t)cb_arg);
+    log_state.trigger_times.push_back(trigger_time);
+    return log_state.repeat_ms;
+}
+
+class DeferredExec : public ::testing::Test {
+   protected:
+    deferred_executor_t table[16];
+    uint32_t            last_exec;
+
+    void SetUp() override {
+        timer_clear();
+        memset(table, 0, sizeof(table));
+        last_exec               = 0;
+        log_state.calls         = {};
+        log_state.trigger_times = {};
+        log_state.repeat_ms     = 0;
+    }
+
+    deferred_token defer(uint32_t delay_ms, uintptr_t id) {
+        return defer_exec_advanced(table, 16, delay_ms, logging_callback, (void *)id);
+    }
+
+    void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            deferred_exec_advanced_task(table, 16, &last_exec);
+        }
+    }
+};
+
+TEST_F(DeferredExec, InvalidArgumentsAreRejected) {
+    EXPECT_EQ(defer_exec_advanced(NULL, 16, 10, logging_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 0, 10, logging_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 16, 0, logging_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_EQ(defer_exec_advanced(table, 16, 10, NULL, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 16, INVALID_DEFERRED_TOKEN));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, 16, INVALID_DEFERRED_TOKEN, 10));
+}
+
+TEST_F(DeferredExec, CallbacksRunInDeadlineOrder) {
+    const uint32_t delays[] = {50, 10, 30, 20, 40, 5, 45, 15};
+    for (uintptr_t i = 0; i < 8; i++) {
+        EXPECT_NE(defer(delays[i], i), INVALID_DEFERRED_TOKEN);
+    }
+
+    run_for(100);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{5, 1, 7, 3, 2, 4, 6, 0}));
+    EXPECT_EQ(log_state.trigger_times, (std::vector<uint32_t>{5, 10, 15, 20, 30, 40, 45, 50}));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), TIMER_NO_DEADLINE);
+}
+
+TEST_F(DeferredExec, CallbackDoesNotRunEarly) {
+    defer(10, 1);
+    run_for(9);
+    EXPECT_TRUE(log_state.calls.empty());
+    run_for(1);
+    EXPECT_EQ(log_state.calls.size(), 1);
+}
+
+TEST_F(DeferredExec, TableFullIsRejected) {
+    for (uintptr_t i = 0; i < 16; i++) {
+        EXPECT_NE(defer(100 + i, i), INVALID_DEFERRED_TOKEN);
+    }
+    EXPECT_EQ(defer(10, 99), INVALID_DEFERRED_TOKEN);
+}
+
+TEST_F(DeferredExec, TokensAreUnique) {
+    std::vector<deferred_token> tokens;
+    for (uintptr_t i = 0; i < 16; i++) {
+        deferred_token token = defer(100, i);
+        for (auto &other : tokens) {
+            EXPECT_NE(token, other);
+        }
+        tokens.push_back(token);
+    }
+}
+
+TEST_F(DeferredExec, CancelRemovesOnlyThatExecutor) {
+    deferred_token a = defer(10, 1);
+    deferred_token b = defer(20, 2);
+    deferred_token c = defer(30, 3);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 16, b));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 16, b));
+    run_for(50);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1, 3}));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 16, a));
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 16, c));
+}
+
+TEST_F(DeferredExec, StaleTokenDoesNotMatchReusedSlot) {
+    deferred_token a = defer(10, 1);
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 16, a));
+
+    deferred_token b = defer(10, 2);
+    EXPECT_NE(a, b);
+    EXPECT_FALSE(cancel_deferred_exec_advanced(table, 16, a));
+    EXPECT_FALSE(extend_deferred_exec_advanced(table, 16, a, 10));
+    run_for(10);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{2}));
+}
+
+TEST_F(DeferredExec, ExtendReordersExecutors) {
+    deferred_token a = defer(10, 1);
+    defer(20, 2);
+
+    run_for(5);
+    EXPECT_TRUE(extend_deferred_exec_advanced(table, 16, a, 30));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), 15);
+    run_for(40);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{2, 1}));
+    EXPECT_EQ(log_state.trigger_times, (std::vector<uint32_t>{20, 35}));
+}
+
+TEST_F(DeferredExec, RepeatingCallbackKeepsCadence) {
+    log_state.repeat_ms = 10;
+    defer(10, 1);
+    defer(25, 2);
+
+    run_for(40);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1, 1, 2, 1, 2, 1}));
+    EXPECT_EQ(log_state.trigger_times, (std::vector<uint32_t>{10, 20, 25, 30, 35, 40}));
+}
+
+TEST_F(DeferredExec, OverdueRepeatingCallbackRunsOncePerPass) {
+    log_state.repeat_ms = 1;
+    defer(1, 1);
+
+    // A 5 ms stall leaves the executor several repeats behind, but a single pass only invokes it once
+    advance_time(5);
+    deferred_exec_advanced_task(table, 16, &last_exec);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1}));
+    EXPECT_EQ(log_state.trigger_times, (std::vector<uint32_t>{1}));
+
+    run_for(2);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1, 1, 1}));
+    EXPECT_EQ(log_state.trigger_times, (std::vector<uint32_t>{1, 2, 3}));
+}
+
+TEST_F(DeferredExec, TimeUntilNext) {
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), TIMER_NO_DEADLINE);
+    deferred_token a = defer(30, 1);
+    defer(12, 2);
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), 12);
+
+    advance_time(20);
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), 0);
+    deferred_exec_advanced_task(table, 16, &last_exec);
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), 10);
+
+    EXPECT_TRUE(cancel_deferred_exec_advanced(table, 16, a));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), TIMER_NO_DEADLINE);
+}
+
+static deferred_executor_t *reentrant_table;
+static deferred_token       reentrant_victim;
+
+static uint32_t cancelling_callback(uint32_t trigger_time, void *cb_arg) {
+    log_state.calls.push_back((uintptr_t)cb_arg);
+    cancel_deferred_exec_advanced(reentrant_table, 16, reentrant_victim);
+    defer_exec_advanced(reentrant_table, 16, 5, logging_callback, (void *)(uintptr_t)9);
+    return 0;
+}
+
+TEST_F(DeferredExec, CallbackCanModifyTable) {
+    reentrant_table = table;
+    defer_exec_advanced(table, 16, 10, cancelling_callback, (void *)(uintptr_t)1);
+    reentrant_victim = defer(10, 2);
+    defer(12, 3);
+
+    run_for(20);
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1, 3, 9}));
+    EXPECT_EQ(deferred_exec_advanced_time_until_next(table, 16), TIMER_NO_DEADLINE);
+}
+
+TEST_F(DeferredExec, BasicApi) {
+    deferred_token a = defer_exec(10, logging_callback, (void *)(uintptr_t)1);
+    deferred_token b = defer_exec(5, logging_callback, (void *)(uintptr_t)2);
+    EXPECT_EQ(deferred_exec_time_until_next(), 5);
+    EXPECT_TRUE(extend_deferred_exec(b, 20));
+    EXPECT_EQ(deferred_exec_time_until_next(), 10);
+    for (uint32_t i = 0; i < 20; i++) {
+        advance_time(1);
+        deferred_exec_task();
+    }
+    EXPECT_EQ(log_state.calls, (std::vector<uintptr_t>{1, 2}));
+    EXPECT_FALSE(cancel_deferred_exec(a));
+    EXPECT_EQ(deferred_exec_time_until_next(), TIMER_NO_DEADLINE);
+}
+
+static uint32_t counting_callback(uint32_t trigger_time, void *cb_arg) {
+    ++*(uint32_t *)cb_arg;
+    return 1;
+}
+
+/* Reports the cost of a main loop pass with many pending executors, only a few of which are due. */
+TEST_F(DeferredExec, ManyPendingBenchmark) {
+    uint32_t                    fired = 0;
+    std::vector<deferred_token> tokens;
+
+    // Move past the basic table's throttle timestamp left over from earlier tests, so no pass is skipped
+    advance_time(1000);
+    for (uint32_t i = 0; i < 200; i++) {
+        deferred_token token = defer_exec(i < 4 ? 1 : 100000 + i, counting_callback, &fired);
+        ASSERT_NE(token, INVALID_DEFERRED_TOKEN);
+        tokens.push_back(token);
+    }
+
+    const uint32_t loops = 20000;
+    auto           start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < loops; i++) {
+        advance_time(1);
+        deferred_exec_task();
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_EQ(fired, loops * 4);
+
+    for (auto &token : tokens) {
+        EXPECT_TRUE(cancel_deferred_exec(token));
+    }
+    printf("200 pending executors: %.1f ns per deferred_exec_task\n", std::chrono::duration<double, std::nano>(elapsed).count() / loops);
+}
@@ -17,6 +17,7 @@
 #include "dynamic_keymap.h"
 #include "keymap_introspection.h"
 #include "action.h"
+#include "action_layer.h"
 #include "eeprom.h"
 #include "progmem.h"
 #include "send_string.h"
@@ -132,6 +133,19 @@ _Static_assert(DYNAMIC_KEYMAP_EEPROM_MAX_ADDR >= DYNAMIC_KEYMAP_MACRO_EEPROM_ADD
 #    define DYNAMIC_KEYMAP_MACRO_DELAY TAP_CODE_DELAY
 #endif
 
+#define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// RAM mirror of the keymap (and encoder map) stored in EEPROM, so that resolving
+// a keycode doesn't have to go through the EEPROM driver on every key event.
+// It is filled once by dynamic_keymap_init() and every write path below updates
+// both the EEPROM and the cache.
+static uint16_t dynamic_keymap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][MATRIX_ROWS][MATRIX_COLS];
+#    ifdef ENCODER_MAP_ENABLE
+static uint16_t dynamic_encodermap_cache[DYNAMIC_KEYMAP_LAYER_COUNT][NUM_ENCODERS][2];
+#    endif
+#endif
+
 uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
@@ -141,8 +155,7 @@ void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t c
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
 }
 
-uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
-    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+static uint16_t dynamic_keymap_read_keycode(uint8_t layer, uint8_t row, uint8_t column) {
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = eeprom_read_byte(address) << 8;
@@ -150,12 +163,27 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     return keycode;
 }
 
+uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    return dynamic_keymap_cache[layer][row][column];
+#else
+    return dynamic_keymap_read_keycode(layer, row, column);
+#endif
+}
+
 void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_keymap_cache[layer][row][column] = keycode;
+#endif
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_switch_cache_update(layer, (keypos_t){.col = column, .row = row});
+#endif
 }
 
 #ifdef ENCODER_MAP_ENABLE
@@ -163,8 +191,7 @@ void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id
     return ((void *)DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR) + (layer * NUM_ENCODERS * 2 * 2) + (encoder_id * 2 * 2);
 }
 
-uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
-    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+static uint16_t dynamic_keymap_read_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     uint16_t keycode = ((uint16_t)eeprom_read_byte(address + (clockwise ? 0 : 2))) << 8;
@@ -172,15 +199,51 @@ uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool cloc
     return keycode;
 }
 
+uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return KC_NO;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    return dynamic_encodermap_cache[layer][encoder_id][clockwise ? 0 : 1];
+#    else
+    return dynamic_keymap_read_encoder(layer, encoder_id, clockwise);
+#    endif
+}
+
 void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode) {
     if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || encoder_id >= NUM_ENCODERS) return;
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    dynamic_encodermap_cache[layer][encoder_id][clockwise ? 0 : 1] = keycode;
+#    endif
     void *address = dynamic_keymap_encoder_to_eeprom_address(layer, encoder_id);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address + (clockwise ? 0 : 2), (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + (clockwise ? 0 : 2) + 1, (uint8_t)(keycode & 0xFF));
+#    if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_switch_cache_update(layer, (keypos_t){.col = encoder_id, .row = clockwise ? KEYLOC_ENCODER_CW : KEYLOC_ENCODER_CCW});
+#    endif
 }
 #endif // ENCODER_MAP_ENABLE
 
+void dynamic_keymap_init(void) {
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                dynamic_keymap_cache[layer][row][column] = dynamic_keymap_read_keycode(layer, row, column);
+            }
+        }
+#    ifdef ENCODER_MAP_ENABLE
+        for (uint8_t encoder = 0; encoder < NUM_ENCODERS; encoder++) {
+            dynamic_encodermap_cache[layer][encoder][0] = dynamic_keymap_read_encoder(layer, encoder, true);
+            dynamic_encodermap_cache[layer][encoder][1] = dynamic_keymap_read_encoder(layer, encoder, false);
+        }
+#    endif
+    }
+#endif
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_switch_cache_invalidate();
+#endif
+}
+
 #ifdef QMK_SETTINGS
 uint8_t dynamic_keymap_get_qmk_settings(uint16_t offset) {
     if (offset >= VIAL_QMK_SETTINGS_SIZE)
@@ -318,29 +381,57 @@ void dynamic_keymap_reset(void) {
 #endif
 }
 
+// Clamps a host supplied buffer request to an EEPROM area of area_size bytes,
+// returning how many of the requested bytes fall inside of it.
+static uint16_t dynamic_keymap_clamp_buffer(uint16_t offset, uint16_t size, uint16_t area_size) {
+    if (offset >= area_size) {
+        return 0;
+    }
+    if (size > area_size - offset) {
+        return area_size - offset;
+    }
+    return size;
+}
+
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *target                     = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t length = dynamic_keymap_clamp_buffer(offset, size, DYNAMIC_KEYMAP_EEPROM_SIZE);
+    if (length > 0) {
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
     }
+    memset(data + length, 0x00, size - length);
 }
 
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+// Mirrors a single byte written to the EEPROM keymap into the RAM cache.
+// The EEPROM layout is big endian, so even offsets hold the high byte.
+static void dynamic_keymap_cache_update_byte(uint16_t offset, uint8_t value) {
+    uint16_t *keycode = &((uint16_t *)dynamic_keymap_cache)[offset / 2];
+    if (offset % 2 == 0) {
+        *keycode = (*keycode & 0x00FF) | ((uint16_t)value << 8);
+    } else {
+        *keycode = (*keycode & 0xFF00) | value;
+    }
+}
+#endif
+
+#if defined(VIAL_ENABLE) && !defined(VIAL_INSECURE)
+// Reads back a single byte of the stored keymap, from the RAM cache if there is one.
+static uint8_t dynamic_keymap_read_buffer_byte(uint16_t offset) {
+#    ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    uint16_t keycode = ((uint16_t *)dynamic_keymap_cache)[offset / 2];
+    return offset % 2 == 0 ? keycode >> 8 : keycode & 0xFF;
+#    else
+    return eeprom_read_byte((uint8_t *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset));
+#    endif
+}
+#endif
+
 void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
-    uint8_t *source                     = data;
+    uint16_t length = dynamic_keymap_clamp_buffer(offset, size, DYNAMIC_KEYMAP_EEPROM_SIZE);
 
 #ifdef VIAL_ENABLE
     /* ensure the writes are bounded */
-    if (offset >= dynamic_keymap_eeprom_size || dynamic_keymap_eeprom_size - offset < size)
+    if (length == 0 || length != size)
         return;
 
 #ifndef VIAL_INSECURE
@@ -352,7 +443,7 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
         /* initial byte misaligned -- this means the first keycode will be a combination of existing and new data */
         if (offset % 2 != 0) {
-            uint16_t kc = (eeprom_read_byte((uint8_t*)target - 1) << 8) | data[0];
+            uint16_t kc = (dynamic_keymap_read_buffer_byte(offset - 1) << 8) | data[0];
             if (kc == QK_BOOT)
                 data[0] = 0xFF;
 
@@ -362,7 +453,7 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 
         /* final byte misaligned -- this means the last keycode will be a combination of new and existing data */
         if ((offset + size) % 2 != 0) {
-            uint16_t kc = (data[size - 1] << 8) | eeprom_read_byte((uint8_t*)target + size);
+            uint16_t kc = (data[size - 1] << 8) | dynamic_keymap_read_buffer_byte(offset + size);
             if (kc == QK_BOOT)
                 data[size - 1] = 0xFF;
 
@@ -382,13 +473,19 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
 #endif
 #endif
 
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < dynamic_keymap_eeprom_size) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    if (length == 0) {
+        return;
     }
+
+    eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset), length);
+#ifdef DYNAMIC_KEYMAP_RAM_CACHE
+    for (uint16_t i = 0; i < length; i++) {
+        dynamic_keymap_cache_update_byte(offset + i, data[i]);
+    }
+#endif
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_switch_cache_invalidate();
+#endif
 }
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
@@ -416,37 +513,25 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *target = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            *target = eeprom_read_byte(source);
-        } else {
-            *target = 0x00;
-        }
-        source++;
-        target++;
+    uint16_t length = dynamic_keymap_clamp_buffer(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (length > 0) {
+        eeprom_read_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
+    memset(data + length, 0x00, size - length);
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
-    uint8_t *source = data;
-    for (uint16_t i = 0; i < size; i++) {
-        if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
-            eeprom_update_byte(target, *source);
-        }
-        source++;
-        target++;
+    uint16_t length = dynamic_keymap_clamp_buffer(offset, size, DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+    if (length > 0) {
+        eeprom_update_block(data, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
 }
 
 void dynamic_keymap_macro_reset(void) {
-    void *p   = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR);
-    void *end = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
-    while (p != end) {
-        eeprom_update_byte(p, 0);
-        ++p;
+    uint8_t zeros[32] = {0};
+    for (uint16_t offset = 0; offset < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE; offset += sizeof(zeros)) {
+        uint16_t length = dynamic_keymap_clamp_buffer(offset, sizeof(zeros), DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE);
+        eeprom_update_block(zeros, (void *)(uintptr_t)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset), length);
     }
 }
 
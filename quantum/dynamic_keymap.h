@@ -30,6 +30,9 @@
 #    define DYNAMIC_KEYMAP_MACRO_COUNT 16
 #endif
 
+// Loads the RAM keymap cache from EEPROM when DYNAMIC_KEYMAP_RAM_CACHE is defined,
+// must be called after the EEPROM driver has been initialized.
+void     dynamic_keymap_init(void);
 uint8_t  dynamic_keymap_get_layer_count(void);
 void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+/* A full size board, so that the keymap spans a realistic amount of EEPROM. */
+#define MATRIX_ROWS 6
+#define MATRIX_COLS 21
+
+#define DYNAMIC_KEYMAP_LAYER_COUNT 4
@@ -0,0 +1,193 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "keycodes.h"
+#include "mock.h"
+}
+
+#define KEYMAP_BUFFER_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+
+class DynamicKeymap : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        vial_unlocked = 0;
+        dynamic_keymap_init();
+        dynamic_keymap_reset();
+    }
+};
+
+TEST_F(DynamicKeymap, ResetLoadsFlashKeymap) {
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), mock_keycode_at(layer, row, column));
+            }
+        }
+    }
+}
+
+TEST_F(DynamicKeymap, OutOfBoundsReturnsNoKey) {
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT, 0, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, MATRIX_ROWS, 0), KC_NO);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, MATRIX_COLS), KC_NO);
+}
+
+TEST_F(DynamicKeymap, SetKeycodeIsStoredBigEndian) {
+    dynamic_keymap_set_keycode(1, 2, 3, 0x1234);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 2, 3), 0x1234);
+
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(1, 2, 3);
+    EXPECT_EQ(eeprom_read_byte(address), 0x12);
+    EXPECT_EQ(eeprom_read_byte(address + 1), 0x34);
+}
+
+TEST_F(DynamicKeymap, SetBufferUpdatesKeycodes) {
+    uint8_t data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+    dynamic_keymap_set_buffer(MATRIX_COLS * 2, sizeof(data), data);
+
+    for (uint8_t column = 0; column < sizeof(data) / 2; column++) {
+        uint8_t  index   = MATRIX_COLS + column;
+        uint16_t keycode = ((column * 2 + 1) << 8) | (column * 2 + 2);
+        EXPECT_EQ(dynamic_keymap_get_keycode(0, index / MATRIX_COLS, index % MATRIX_COLS), keycode);
+    }
+}
+
+TEST_F(DynamicKeymap, SetBufferMisalignedUpdatesKeycodes) {
+    uint8_t data[3] = {0xAB, 0xCD, 0xEF};
+    dynamic_keymap_set_buffer(1, sizeof(data), data);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), (mock_keycode_at(0, 0, 0) & 0xFF00) | 0xAB);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), 0xCDEF);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 2), mock_keycode_at(0, 0, 2));
+}
+
+TEST_F(DynamicKeymap, SetBufferRejectsBootWhenLocked) {
+    uint8_t data[2] = {QK_BOOT >> 8, QK_BOOT & 0xFF};
+    dynamic_keymap_set_buffer(0, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), 0xFFFF);
+
+    vial_unlocked = 1;
+    data[0]       = QK_BOOT >> 8;
+    data[1]       = QK_BOOT & 0xFF;
+    dynamic_keymap_set_buffer(0, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), QK_BOOT);
+}
+
+TEST_F(DynamicKeymap, SetBufferOutOfBoundsIsIgnored) {
+    uint8_t data[2] = {0x12, 0x34};
+    dynamic_keymap_set_buffer(KEYMAP_BUFFER_SIZE - 1, sizeof(data), data);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), mock_keycode_at(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1));
+}
+
+TEST_F(DynamicKeymap, GetBufferMatchesKeycodes) {
+    static uint8_t data[KEYMAP_BUFFER_SIZE];
+    dynamic_keymap_set_keycode(2, 1, 0, 0xBEEF);
+    dynamic_keymap_get_buffer(0, sizeof(data), data);
+
+    for (uint16_t i = 0; i < KEYMAP_BUFFER_SIZE / 2; i++) {
+        uint8_t  layer  = i / (MATRIX_ROWS * MATRIX_COLS);
+        uint8_t  row    = (i / MATRIX_COLS) % MATRIX_ROWS;
+        uint8_t  column = i % MATRIX_COLS;
+        uint16_t stored = (data[i * 2] << 8) | data[i * 2 + 1];
+        EXPECT_EQ(stored, dynamic_keymap_get_keycode(layer, row, column));
+    }
+}
+
+TEST_F(DynamicKeymap, GetBufferPastEndIsZeroFilled) {
+    uint8_t data[4] = {0xAA, 0xAA, 0xAA, 0xAA};
+    dynamic_keymap_get_buffer(KEYMAP_BUFFER_SIZE - 2, sizeof(data), data);
+
+    uint16_t last = mock_keycode_at(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1);
+    EXPECT_EQ(data[0], last >> 8);
+    EXPECT_EQ(data[1], last & 0xFF);
+    EXPECT_EQ(data[2], 0x00);
+    EXPECT_EQ(data[3], 0x00);
+}
+
+TEST_F(DynamicKeymap, MacroBufferRoundTrip) {
+    uint16_t size = dynamic_keymap_macro_get_buffer_size();
+    uint8_t  data[28];
+    for (uint8_t i = 0; i < sizeof(data); i++) {
+        data[i] = 0x40 + i;
+    }
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_set_buffer(5, sizeof(data), data);
+
+    uint8_t read[sizeof(data) + 2];
+    dynamic_keymap_macro_get_buffer(4, sizeof(read), read);
+    EXPECT_EQ(read[0], 0x00);
+    EXPECT_EQ(memcmp(&read[1], data, sizeof(data)), 0);
+    EXPECT_EQ(read[sizeof(read) - 1], 0x00);
+
+    // Writes running past the end of the macro buffer are truncated, reads past it are zero-filled
+    dynamic_keymap_macro_set_buffer(size - 2, 4, data);
+    dynamic_keymap_macro_get_buffer(size - 2, 4, read);
+    EXPECT_EQ(read[0], data[0]);
+    EXPECT_EQ(read[1], data[1]);
+    EXPECT_EQ(read[2], 0x00);
+    EXPECT_EQ(read[3], 0x00);
+
+    dynamic_keymap_macro_reset();
+    dynamic_keymap_macro_get_buffer(0, sizeof(read), read);
+    for (uint8_t i = 0; i < sizeof(read); i++) {
+        EXPECT_EQ(read[i], 0x00);
+    }
+}
+
+TEST_F(DynamicKeymap, InitReloadsFromEeprom) {
+    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(3, 5, 20);
+    eeprom_update_byte(address, 0x56);
+    eeprom_update_byte(address + 1, 0x78);
+
+    dynamic_keymap_init();
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 5, 20), 0x5678);
+}
+
+/* Reports the cost of resolving a keycode through the dynamic keymap, compared to reading the
+ * keycode straight out of EEPROM the way the uncached lookup does. */
+TEST_F(DynamicKeymap, LookupBenchmark) {
+    const uint32_t iterations = 200;
+    volatile uint16_t sink    = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                    uint8_t *address = (uint8_t *)dynamic_keymap_key_to_eeprom_address(layer, row, column);
+                    sink             = (eeprom_read_byte(address) << 8) | eeprom_read_byte(address + 1);
+                }
+            }
+        }
+    }
+    auto eeprom_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < iterations; i++) {
+        for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+            for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+                for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                    sink = dynamic_keymap_get_keycode(layer, row, column);
+                }
+            }
+        }
+    }
+    auto lookup_time = std::chrono::steady_clock::now() - start;
+    (void)sink;
+
+    const double lookups = (double)iterations * DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS;
+    printf("EEPROM read:            %.2f ns/lookup\n", std::chrono::duration<double, std::nano>(eeprom_time).count() / lookups);
+    printf("dynamic_keymap lookup:  %.2f ns/lookup\n", std::chrono::duration<double, std::nano>(lookup_time).count() / lookups);
+}
@@ -0,0 +1,23 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdbool.h>
+#include "mock.h"
+#include "keycodes.h"
+
+int vial_unlocked = 0;
+
+uint16_t mock_keycode_at(uint8_t layer, uint8_t row, uint8_t column) {
+    return KC_A + ((layer * 7 + row * MATRIX_COLS + column) % (KC_Z - KC_A + 1));
+}
+
+uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
+    return mock_keycode_at(layer_num, row, column);
+}
+
+void send_string(const char *string) {}
+void send_string_with_delay(const char *string, uint8_t interval) {}
+void vial_keycode_down(uint16_t keycode) {}
+void vial_keycode_up(uint16_t keycode) {}
+void vial_keycode_tap(uint16_t keycode) {}
+void wait_ms(uint32_t ms) {}
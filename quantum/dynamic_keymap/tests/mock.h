@@ -0,0 +1,7 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#pragma once
+
+#include <stdint.h>
+
+uint16_t mock_keycode_at(uint8_t layer, uint8_t row, uint8_t column);
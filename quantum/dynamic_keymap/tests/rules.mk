@@ -0,0 +1,12 @@
+dynamic_keymap_DEFS := -DDYNAMIC_KEYMAP_ENABLE -DVIAL_ENABLE -DEEPROM_CUSTOM -DEEPROM_SIZE=2048
+dynamic_keymap_CONFIG := $(QUANTUM_PATH)/dynamic_keymap/tests/config_mock.h
+
+dynamic_keymap_SRC := \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/mock.c \
+	$(QUANTUM_PATH)/dynamic_keymap/tests/dynamic_keymap_tests.cpp \
+	$(QUANTUM_PATH)/dynamic_keymap.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom.c
+
+dynamic_keymap_ram_cache_DEFS := $(dynamic_keymap_DEFS) -DDYNAMIC_KEYMAP_RAM_CACHE
+dynamic_keymap_ram_cache_CONFIG := $(dynamic_keymap_CONFIG)
+dynamic_keymap_ram_cache_SRC := $(dynamic_keymap_SRC)
@@ -0,0 +1,193 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "key_latency.h"
+#include "action.h"
+#include "action_tapping.h"
+#include "timer.h"
+#include "util.h"
+
+#ifdef COMBO_ENABLE
+#    include "process_combo.h"
+#endif
+
+// Bucket indices are exchanged as single bytes over raw HID, the bucket width as two
+#if KEY_LATENCY_BUCKETS < 1 || KEY_LATENCY_BUCKETS > 255
+#    error "KEY_LATENCY_BUCKETS must be between 1 and 255"
+#endif
+#if KEY_LATENCY_BUCKET_WIDTH < 1 || KEY_LATENCY_BUCKET_WIDTH > 65535
+#    error "KEY_LATENCY_BUCKET_WIDTH must be between 1 and 65535"
+#endif
+
+// How long timer_read_cycles() is measured against the millisecond timer for
+#define KEY_LATENCY_CALIBRATION_MS 256
+
+// A point in time, in both milliseconds and timer_read_cycles() units
+typedef struct {
+    uint32_t ms;
+    uint32_t cycles;
+} key_latency_time_t;
+
+static key_latency_histogram_t histograms[KEY_LATENCY_STAGE_COUNT];
+static uint32_t                dropped = 0;
+
+// Rate of timer_read_cycles(), zero until calibrated
+static uint32_t           cycles_per_ms = 0;
+static bool               calibrating   = false;
+static key_latency_time_t calibration_start;
+
+// Change working its way through debounce
+static bool               raw_pending = false;
+static key_latency_time_t raw_time;
+static bool               debounced = false;
+static key_latency_time_t debounce_start;
+
+// The one change in flight, any further changes before its report are folded into it
+static bool               sample_active    = false;
+static bool               sample_processed = false;
+static key_latency_time_t sample_raw_time;
+static key_latency_time_t sample_detect_time;
+static key_latency_time_t sample_process_time;
+
+/** \brief Reads both timers, and measures the rate of timer_read_cycles() as the unit differs between platforms. */
+static key_latency_time_t now(void) {
+    key_latency_time_t time    = {.ms = timer_read32(), .cycles = timer_read_cycles()};
+    uint32_t           elapsed = TIMER_DIFF_32(time.ms, calibration_start.ms);
+
+    if (!calibrating) {
+        calibrating       = true;
+        calibration_start = time;
+    } else if (elapsed >= KEY_LATENCY_CALIBRATION_MS) {
+        // The cycle counter may have wrapped during longer gaps, which happens after seconds on fast cores
+        if (elapsed < 16 * KEY_LATENCY_CALIBRATION_MS) {
+            cycles_per_ms = TIMER_DIFF_32(time.cycles, calibration_start.cycles) / elapsed;
+        }
+        calibration_start = time;
+    }
+    return time;
+}
+
+/** \brief Microseconds between two points, from the cycle counter once its rate is known. */
+static uint32_t elapsed_us(key_latency_time_t from, key_latency_time_t to) {
+    uint32_t ms = TIMER_DIFF_32(to.ms, from.ms);
+
+    if (cycles_per_ms == 0 || ms >= UINT32_MAX / cycles_per_ms / 2) {
+        return ms * 1000;
+    }
+    return (uint64_t)TIMER_DIFF_32(to.cycles, from.cycles) * 1000 / cycles_per_ms;
+}
+
+static void record(key_latency_stage_t stage, uint32_t elapsed) {
+    key_latency_histogram_t *histogram = &histograms[stage];
+    uint32_t                 bucket    = MIN(elapsed / KEY_LATENCY_BUCKET_WIDTH, KEY_LATENCY_BUCKETS - 1);
+
+    if (histogram->count == 0 || elapsed < histogram->min) {
+        histogram->min = elapsed;
+    }
+    if (elapsed > histogram->max) {
+        histogram->max = elapsed;
+    }
+    histogram->count++;
+    histogram->sum += elapsed;
+    if (histogram->buckets[bucket] < UINT16_MAX) {
+        histogram->buckets[bucket]++;
+    }
+}
+
+/** \brief Whether the key change in flight is still held back by tap-hold or combo buffering. */
+static bool sample_is_buffered(void) {
+#ifndef NO_ACTION_TAPPING
+    if (action_tapping_time_until_next() != TIMER_NO_DEADLINE) {
+        return true;
+    }
+#endif
+#ifdef COMBO_ENABLE
+    if (combo_time_until_next() != TIMER_NO_DEADLINE) {
+        return true;
+    }
+#endif
+    return false;
+}
+
+const key_latency_histogram_t *key_latency_get_histogram(key_latency_stage_t stage) {
+    if (stage >= KEY_LATENCY_STAGE_COUNT) {
+        return NULL;
+    }
+    return &histograms[stage];
+}
+
+uint32_t key_latency_get_dropped(void) {
+    return dropped;
+}
+
+void key_latency_reset(void) {
+    memset(histograms, 0, sizeof(histograms));
+    dropped       = 0;
+    raw_pending   = false;
+    debounced     = false;
+    sample_active = false;
+}
+
+void key_latency_debounce_task(bool changed, bool settled) {
+    if (changed) {
+        debounce_start = raw_pending ? raw_time : now();
+        debounced      = true;
+        raw_pending    = false;
+    }
+    if (settled) {
+        raw_pending = false;
+    } else if (!raw_pending) {
+        raw_pending = true;
+        raw_time    = now();
+    }
+}
+
+void key_latency_key_change(void) {
+    key_latency_time_t time = now();
+
+    if (sample_active) {
+        if (TIMER_DIFF_32(time.ms, sample_raw_time.ms) > KEY_LATENCY_TIMEOUT) {
+            dropped++;
+            sample_active = false;
+        } else if (sample_processed && !sample_is_buffered()) {
+            // The previous change was fully handled without producing a report
+            sample_active = false;
+        }
+    }
+
+    if (!sample_active) {
+        sample_active      = true;
+        sample_processed   = false;
+        sample_raw_time    = debounced ? debounce_start : time;
+        sample_detect_time = time;
+    }
+    debounced = false;
+}
+
+void key_latency_processed(void) {
+    if (sample_active && !sample_processed) {
+        sample_processed    = true;
+        sample_process_time = now();
+    }
+}
+
+void key_latency_report_sent(void) {
+    if (!sample_active) {
+        return;
+    }
+    sample_active = false;
+
+    key_latency_time_t time         = now();
+    key_latency_time_t process_time = sample_processed ? sample_process_time : time;
+
+    if (TIMER_DIFF_32(time.ms, sample_raw_time.ms) > KEY_LATENCY_TIMEOUT) {
+        dropped++;
+        return;
+    }
+
+    record(KEY_LATENCY_TOTAL, elapsed_us(sample_raw_time, time));
+    record(KEY_LATENCY_DEBOUNCE, elapsed_us(sample_raw_time, sample_detect_time));
+    record(KEY_LATENCY_PROCESS, elapsed_us(sample_detect_time, process_time));
+    record(KEY_LATENCY_BUFFER, elapsed_us(process_time, time));
+}
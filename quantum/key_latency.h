@@ -0,0 +1,82 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/*
+    Scan-to-report latency tracking.
+
+    A sample starts when the matrix reports a debounced key change and ends when the next keyboard
+    report goes out to the host. Only one sample is in flight at a time: changes that arrive while
+    an earlier change is still being held back (by tap-hold or combo buffering) are folded into the
+    earlier sample, so their own process and buffer times are not recorded, and changes that never
+    produce a report (layer keys, one-shot mods, ...) are replaced by the next change. Every sample
+    is split into stages:
+
+        debounce: first raw change seen by the matrix scan until debounce let it through
+        process:  debounced change until action_exec and the process_record chain returned
+        buffer:   process_record chain returned until the report was sent
+
+    All times are in microseconds, taken from timer_read_cycles() once its rate has been measured
+    against the millisecond timer, which takes a few hundred milliseconds after boot. Until then,
+    and on platforms whose cycle counter is the system tick, the resolution is that of the tick.
+*/
+
+#ifndef KEY_LATENCY_BUCKETS
+#    define KEY_LATENCY_BUCKETS 16
+#endif
+
+// In microseconds
+#ifndef KEY_LATENCY_BUCKET_WIDTH
+#    define KEY_LATENCY_BUCKET_WIDTH 500
+#endif
+
+// Samples still waiting for a report after this many milliseconds are dropped
+#ifndef KEY_LATENCY_TIMEOUT
+#    define KEY_LATENCY_TIMEOUT 1000
+#endif
+
+typedef enum {
+    KEY_LATENCY_TOTAL,
+    KEY_LATENCY_DEBOUNCE,
+    KEY_LATENCY_PROCESS,
+    KEY_LATENCY_BUFFER,
+    KEY_LATENCY_STAGE_COUNT,
+} key_latency_stage_t;
+
+typedef struct {
+    uint32_t count;
+    uint64_t sum;
+    uint32_t min;
+    uint32_t max;
+    // The last bucket also collects everything beyond the histogram range
+    uint16_t buckets[KEY_LATENCY_BUCKETS];
+} key_latency_histogram_t;
+
+/** \brief Histogram for one stage, or NULL for an invalid stage. */
+const key_latency_histogram_t *key_latency_get_histogram(key_latency_stage_t stage);
+
+/** \brief Number of samples dropped because no report followed within KEY_LATENCY_TIMEOUT. */
+uint32_t key_latency_get_dropped(void);
+
+/** \brief Clears all histograms and any sample in flight. */
+void key_latency_reset(void);
+
+/** \brief Called by the matrix scan after debounce.
+ *
+ * \param changed debounce let a change through during this scan
+ * \param settled the raw and debounced matrices agree after this scan
+ */
+void key_latency_debounce_task(bool changed, bool settled);
+
+/** \brief Called by matrix_task when it picks up a debounced change, before any action_exec. */
+void key_latency_key_change(void);
+
+/** \brief Called by matrix_task once action_exec has run for every changed key. */
+void key_latency_processed(void);
+
+/** \brief Called by the host layer whenever a keyboard report is sent. */
+void key_latency_report_sent(void);
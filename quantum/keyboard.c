@@ -32,12 +32,19 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "profiling.h"
+#ifdef TICKLESS_IDLE
+#    include "debounce.h"
+#endif
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
 #ifdef AUDIO_ENABLE
 #    include "audio.h"
 #endif
+#ifdef AUDIO_MIXER_ENABLE
+#    include "audio_mixer.h"
+#endif
 #if defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))
 #    include "process_music.h"
 #endif
@@ -104,6 +111,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef VIA_ENABLE
 #    include "via.h"
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+#    include "dynamic_keymap.h"
+#endif
 #ifdef DIP_SWITCH_ENABLE
 #    include "dip_switch.h"
 #endif
@@ -146,6 +156,18 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef OS_DETECTION_ENABLE
 #    include "os_detection.h"
 #endif
+#ifdef DEFERRED_EXEC_ENABLE
+#    include "deferred_exec.h"
+#endif
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+#ifdef TICKLESS_IDLE
+#    include "wait.h"
+#    ifndef TICKLESS_IDLE_MAX_WAIT
+#        define TICKLESS_IDLE_MAX_WAIT 1
+#    endif
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -325,6 +347,9 @@ void keyboard_setup(void) {
 #ifdef EEPROM_DRIVER
     eeprom_driver_init();
 #endif
+#ifdef DYNAMIC_KEYMAP_ENABLE
+    dynamic_keymap_init();
+#endif
 #ifdef VIAL_ENABLE
     vial_init();
 #endif
@@ -527,6 +552,13 @@ static inline void generate_tick_event(void) {
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
+#ifdef TICKLESS_IDLE
+        // Tick events only drive timeouts, so there's nothing to do until one is due
+        if (action_exec_time_until_next() != 0) {
+            last_tick = now;
+            return;
+        }
+#endif
         action_exec(MAKE_TICK_EVENT);
         last_tick = now;
     }
@@ -567,6 +599,10 @@ static bool matrix_task(void) {
 
     const bool process_keypress = should_process_keypress();
 
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_key_change();
+#endif
+
     for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
         const matrix_row_t current_row = matrix_get_row(row);
         const matrix_row_t row_changes = current_row ^ matrix_previous[row];
@@ -591,6 +627,10 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+#ifdef KEY_LATENCY_ENABLE
+    key_latency_processed();
+#endif
+
     return matrix_changed;
 }
 
@@ -669,6 +709,98 @@ void quantum_task(void) {
 #endif
 }
 
+#ifdef TICKLESS_IDLE
+/** \brief Fallback for DEBOUNCE_TYPE = custom algorithms which cannot report when they settle
+ *
+ * Assumes a change may always be pending, so the keyboard keeps polling.
+ */
+__attribute__((weak)) uint32_t debounce_time_until_next(void) {
+    return 0;
+}
+
+/** \brief Time until keyboard_task next has work to do
+ *
+ * Covers the subsystems which wait on timeouts, poll intervals or frame timers. Matrix, encoder and
+ * other input changes are not covered, so waking on those is left to keyboard_idle_wait_kb().
+ *
+ * \return milliseconds until the earliest deadline, zero if there is work pending now, or TIMER_NO_DEADLINE when idle
+ */
+uint32_t keyboard_time_until_next(void) {
+#    ifdef SPLIT_KEYBOARD
+    // The halves exchange matrix and state on every scan, which no deadline describes
+    return 0;
+#    else
+    uint32_t next = action_exec_time_until_next();
+    next          = MIN(next, debounce_time_until_next());
+
+#        ifdef COMBO_ENABLE
+    next = MIN(next, combo_time_until_next());
+#        endif
+#        ifdef TAP_DANCE_ENABLE
+    next = MIN(next, tap_dance_time_until_next());
+#        endif
+#        ifdef LEADER_ENABLE
+    next = MIN(next, leader_time_until_next());
+#        endif
+#        ifdef CAPS_WORD_ENABLE
+    next = MIN(next, caps_word_time_until_next());
+#        endif
+#        ifdef DEFERRED_EXEC_ENABLE
+    next = MIN(next, deferred_exec_time_until_next());
+#        endif
+#        if defined(RGBLIGHT_ENABLE)
+    next = MIN(next, rgblight_time_until_next());
+#        endif
+#        ifdef LED_MATRIX_ENABLE
+    next = MIN(next, led_matrix_time_until_next());
+#        endif
+#        ifdef RGB_MATRIX_ENABLE
+    next = MIN(next, rgb_matrix_time_until_next());
+#        endif
+#        ifdef AUDIO_MIXER_ENABLE
+    next = MIN(next, audio_mixer_time_until_next());
+#        endif
+#        ifdef AUTO_SHIFT_ENABLE
+    next = MIN(next, autoshift_time_until_next());
+#        endif
+#        ifdef KEY_OVERRIDE_ENABLE
+    next = MIN(next, key_override_time_until_next());
+#        endif
+#        ifdef MOUSEKEY_ENABLE
+    next = MIN(next, mousekey_time_until_next());
+#        endif
+#        ifdef POINTING_DEVICE_ENABLE
+    next = MIN(next, pointing_device_time_until_next());
+#        endif
+#        ifdef OLED_ENABLE
+    next = MIN(next, oled_time_until_next());
+#        endif
+
+    return next;
+#    endif
+}
+
+/** \brief Waits for up to the given number of milliseconds while idle
+ *
+ * The default waits at most TICKLESS_IDLE_MAX_WAIT (1 ms) before the matrix is polled again, adding up to
+ * that much scan latency. Out of the box this only saves main loop iterations, not power: the MCU keeps
+ * running. Boards may override this to sleep for the whole duration only if they also wake on every input the
+ * deadlines do not cover: matrix changes, encoders, and any other polled hardware.
+ */
+__attribute__((weak)) void keyboard_idle_wait_kb(uint32_t ms) {
+    // The matrix still has to be polled, so only sleep for a short while at a time
+    wait_ms(MIN(ms, TICKLESS_IDLE_MAX_WAIT));
+}
+
+/** \brief Sleeps until the next deadline, to be executed by the main loop */
+void keyboard_idle_task(void) {
+    uint32_t next = keyboard_time_until_next();
+    if (next > 0) {
+        keyboard_idle_wait_kb(next);
+    }
+}
+#endif
+
 /** \brief Main task that is repeatedly called as fast as possible. */
 void keyboard_task(void) {
     __attribute__((unused)) bool activity_has_occurred = false;
@@ -677,7 +809,11 @@ void keyboard_task(void) {
         activity_has_occurred = true;
     }
 
-    quantum_task();
+    PROFILE_ZONE(quantum_task());
+
+#if defined(LAYER_SWITCH_CACHE) && !defined(NO_ACTION_LAYER)
+    layer_switch_cache_task();
+#endif
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
     split_watchdog_task();
@@ -691,7 +827,7 @@ void keyboard_task(void) {
     led_matrix_task();
 #endif
 #ifdef RGB_MATRIX_ENABLE
-    rgb_matrix_task();
+    PROFILE_ZONE(rgb_matrix_task());
 #endif
 
 #if defined(BACKLIGHT_ENABLE)
@@ -700,6 +836,10 @@ void keyboard_task(void) {
 #    endif
 #endif
 
+#ifdef AUDIO_MIXER_ENABLE
+    audio_mixer_task();
+#endif
+
 #ifdef ENCODER_ENABLE
     if (encoder_task()) {
         last_encoder_activity_trigger();
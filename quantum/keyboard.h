@@ -123,6 +123,12 @@ void housekeeping_task(void);      // To be executed by the main loop in each ba
 void housekeeping_task_kb(void);   // To be overridden by keyboard-level code
 void housekeeping_task_user(void); // To be overridden by user/keymap-level code
 
+#ifdef TICKLESS_IDLE
+uint32_t keyboard_time_until_next(void);     // Number of milliseconds until the earliest pending deadline
+void     keyboard_idle_task(void);           // To be executed by the main loop, waits until the next deadline
+void     keyboard_idle_wait_kb(uint32_t ms); // To be overridden by keyboard-level code, e.g. to sleep until a matrix interrupt
+#endif
+
 uint32_t last_input_activity_time(void);    // Timestamp of the last matrix or encoder or pointing device activity
 uint32_t last_input_activity_elapsed(void); // Number of milliseconds since the last matrix or encoder or pointing device activity
 
@@ -64,6 +64,17 @@ bool leader_sequence_add(uint16_t keycode) {
     return true;
 }
 
+uint32_t leader_time_until_next(void) {
+#if defined(LEADER_NO_TIMEOUT)
+    if (!leading || leader_sequence_size == 0) {
+#else
+    if (!leading) {
+#endif
+        return TIMER_NO_DEADLINE;
+    }
+    return timer_remaining(leader_time, LEADER_TIMEOUT + 1);
+}
+
 bool leader_sequence_timed_out(void) {
 #if defined(LEADER_NO_TIMEOUT)
     return leader_sequence_size > 0 && timer_elapsed(leader_time) > LEADER_TIMEOUT;
@@ -350,6 +350,15 @@ void led_matrix_task(void) {
     }
 }
 
+uint32_t led_matrix_time_until_next(void) {
+    // Rendering and flushing are spread over consecutive task runs, only the wait for the next frame is idle
+    if (led_task_state != SYNCING) {
+        return 0;
+    }
+    uint32_t elapsed = sync_timer_elapsed32(g_led_timer);
+    return elapsed >= LED_MATRIX_LED_FLUSH_LIMIT ? 0 : LED_MATRIX_LED_FLUSH_LIMIT - elapsed;
+}
+
 void led_matrix_indicators(void) {
     led_matrix_indicators_kb();
 }
@@ -15,6 +15,7 @@
  */
 
 #include "keyboard.h"
+#include "profiling.h"
 
 void platform_setup(void);
 
@@ -47,7 +48,7 @@ int main(void) {
     /* Main loop */
     while (true) {
         protocol_pre_task();
-        protocol_keyboard_task();
+        PROFILE_ZONE_NAMED("keyboard_task", protocol_keyboard_task());
         protocol_post_task();
 
 #ifdef RAW_ENABLE
@@ -63,7 +64,7 @@ int main(void) {
 #ifdef QUANTUM_PAINTER_ENABLE
         // Run Quantum Painter task
         void qp_internal_task(void);
-        qp_internal_task();
+        PROFILE_ZONE(qp_internal_task());
 #endif
 
 #ifdef DEFERRED_EXEC_ENABLE
@@ -72,6 +73,22 @@ int main(void) {
         deferred_exec_task();
 #endif // DEFERRED_EXEC_ENABLE
 
-        housekeeping_task();
+#ifdef PROFILING_ENABLE
+        // Periodically print the profiling zones
+        profiling_task();
+#endif // PROFILING_ENABLE
+
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSPORT_STATS)
+        // Periodically print the split link statistics
+        void split_transaction_stats_task(void);
+        split_transaction_stats_task();
+#endif // defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSPORT_STATS)
+
+        PROFILE_ZONE(housekeeping_task());
+
+#ifdef TICKLESS_IDLE
+        // Sleep until the next deadline rather than spinning
+        keyboard_idle_task();
+#endif // TICKLESS_IDLE
     }
 }
@@ -22,6 +22,10 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "debounce.h"
 #include "atomic_util.h"
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -340,9 +344,16 @@ uint8_t matrix_scan(void) {
     if (changed) memcpy(raw_matrix, curr_matrix, sizeof(curr_matrix));
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_debounce_task(changed, memcmp(raw_matrix, matrix + thisHand, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0);
+#    endif
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_debounce_task(changed, memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0);
+#    endif
     matrix_scan_kb();
 #endif
     return (uint8_t)changed;
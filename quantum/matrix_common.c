@@ -4,6 +4,11 @@
 #include "print.h"
 #include "debug.h"
 
+#ifdef KEY_LATENCY_ENABLE
+#    include <string.h>
+#    include "key_latency.h"
+#endif
+
 #ifdef SPLIT_KEYBOARD
 #    include "split_common/split_util.h"
 #    include "split_common/transactions.h"
@@ -169,9 +174,16 @@ __attribute__((weak)) uint8_t matrix_scan(void) {
     bool changed = matrix_scan_custom(raw_matrix);
 
 #ifdef SPLIT_KEYBOARD
-    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed) | matrix_post_scan();
+    changed = debounce(raw_matrix, matrix + thisHand, ROWS_PER_HAND, changed);
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_debounce_task(changed, memcmp(raw_matrix, matrix + thisHand, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0);
+#    endif
+    changed |= matrix_post_scan();
 #else
     changed = debounce(raw_matrix, matrix, ROWS_PER_HAND, changed);
+#    ifdef KEY_LATENCY_ENABLE
+    key_latency_debounce_task(changed, memcmp(raw_matrix, matrix, sizeof(matrix_row_t) * ROWS_PER_HAND) == 0);
+#    endif
     matrix_scan_kb();
 #endif
 
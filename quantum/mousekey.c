@@ -639,6 +639,22 @@ void mousekey_send(void) {
     host_mouse_send(&mouse_report);
 }
 
+/** \brief Time until mousekey_task has a repeat or acceleration step to send
+ *
+ * \return zero while the cursor or wheel is moving, or TIMER_NO_DEADLINE when idle
+ */
+uint32_t mousekey_time_until_next(void) {
+    if (mouse_report.x || mouse_report.y || mouse_report.v || mouse_report.h) {
+        return 0;
+    }
+#ifdef MOUSEKEY_INERTIA
+    if (mousekey_frame) {
+        return 0;
+    }
+#endif
+    return TIMER_NO_DEADLINE;
+}
+
 void mousekey_clear(void) {
     mouse_report          = (report_mouse_t){};
     mousekey_repeat       = 0;
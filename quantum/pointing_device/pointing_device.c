@@ -35,6 +35,38 @@
 #    endif
 #endif
 
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] int16_t value
+ * @return int8_t clamped value
+ */
+static inline int8_t pointing_device_hv_clamp(int16_t value) {
+    if (value < INT8_MIN) {
+        return INT8_MIN;
+    } else if (value > INT8_MAX) {
+        return INT8_MAX;
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief clamps int16_t to int8_t
+ *
+ * @param[in] clamp_range_t value
+ * @return mouse_xy_report_t clamped value
+ */
+static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
+    if (value < XY_REPORT_MIN) {
+        return XY_REPORT_MIN;
+    } else if (value > XY_REPORT_MAX) {
+        return XY_REPORT_MAX;
+    } else {
+        return value;
+    }
+}
+
 #if defined(SPLIT_POINTING_ENABLE)
 #    include "transactions.h"
 #    include "keyboard.h"
@@ -50,6 +82,13 @@ uint16_t       shared_cpi          = 0;
  * @param[in] new_mouse_report report_mouse_t
  */
 void pointing_device_set_shared_report(report_mouse_t new_mouse_report) {
+#    ifdef SPLIT_TRANSPORT_DELTA
+    // Only carries the motion since the last one, which adds up until the pointing device task uses it
+    new_mouse_report.x = pointing_device_xy_clamp((clamp_range_t)shared_mouse_report.x + new_mouse_report.x);
+    new_mouse_report.y = pointing_device_xy_clamp((clamp_range_t)shared_mouse_report.y + new_mouse_report.y);
+    new_mouse_report.h = pointing_device_hv_clamp((int16_t)shared_mouse_report.h + new_mouse_report.h);
+    new_mouse_report.v = pointing_device_hv_clamp((int16_t)shared_mouse_report.v + new_mouse_report.v);
+#    endif
     shared_mouse_report = new_mouse_report;
 }
 
@@ -225,6 +264,29 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
  * It applies any optional configuration e.g. rotation or axis inversion and then initiates a send.
  *
  */
+#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+static uint32_t pointing_device_last_exec = 0;
+#endif
+
+/**
+ * \brief Time until the pointing device is next polled
+ *
+ * \return milliseconds until the next poll, or zero if the sensor is polled on every pass
+ */
+uint32_t pointing_device_time_until_next(void) {
+#if defined(SPLIT_POINTING_ENABLE)
+    if (!is_keyboard_master()) {
+        return TIMER_NO_DEADLINE;
+    }
+#endif
+#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+    uint32_t elapsed = timer_elapsed32(pointing_device_last_exec);
+    return elapsed >= POINTING_DEVICE_TASK_THROTTLE_MS ? 0 : POINTING_DEVICE_TASK_THROTTLE_MS - elapsed;
+#else
+    return 0;
+#endif
+}
+
 __attribute__((weak)) bool pointing_device_task(void) {
 #if defined(SPLIT_POINTING_ENABLE)
     // Don't poll the target side pointing device.
@@ -234,11 +296,10 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #endif
 
 #if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
-    static uint32_t last_exec = 0;
-    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+    if (timer_elapsed32(pointing_device_last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
     }
-    last_exec = timer_read32();
+    pointing_device_last_exec = timer_read32();
 #endif
 
     // Gather report info
@@ -286,6 +347,13 @@ __attribute__((weak)) bool pointing_device_task(void) {
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
+#endif
+#if defined(SPLIT_POINTING_ENABLE) && defined(SPLIT_TRANSPORT_DELTA)
+    // The shared motion has been used, only the buttons carry over
+    shared_mouse_report.x = 0;
+    shared_mouse_report.y = 0;
+    shared_mouse_report.h = 0;
+    shared_mouse_report.v = 0;
 #endif
     // automatic mouse layer function
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
@@ -376,37 +444,6 @@ void pointing_device_set_cpi_on_side(bool left, uint16_t cpi) {
     }
 }
 
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] int16_t value
- * @return int8_t clamped value
- */
-static inline int8_t pointing_device_hv_clamp(int16_t value) {
-    if (value < INT8_MIN) {
-        return INT8_MIN;
-    } else if (value > INT8_MAX) {
-        return INT8_MAX;
-    } else {
-        return value;
-    }
-}
-
-/**
- * @brief clamps int16_t to int8_t
- *
- * @param[in] clamp_range_t value
- * @return mouse_xy_report_t clamped value
- */
-static inline mouse_xy_report_t pointing_device_xy_clamp(clamp_range_t value) {
-    if (value < XY_REPORT_MIN) {
-        return XY_REPORT_MIN;
-    } else if (value > XY_REPORT_MAX) {
-        return XY_REPORT_MAX;
-    } else {
-        return value;
-    }
-}
 /**
  * @brief combines 2 mouse reports and returns 2
  *
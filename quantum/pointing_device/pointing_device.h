@@ -104,6 +104,7 @@ typedef int16_t clamp_range_t;
 
 void           pointing_device_init(void);
 bool           pointing_device_task(void);
+uint32_t       pointing_device_time_until_next(void);
 bool           pointing_device_send(void);
 report_mouse_t pointing_device_get_report(void);
 void           pointing_device_set_report(report_mouse_t mouse_report);
@@ -322,6 +322,20 @@ void autoshift_matrix_scan(void) {
     }
 }
 
+/** \brief Milliseconds until the pending auto-shifted key times out, or TIMER_NO_DEADLINE if none is pending */
+uint32_t autoshift_time_until_next(void) {
+    if (!QS_auto_shift_enable || !autoshift_flags.in_progress) {
+        return TIMER_NO_DEADLINE;
+    }
+    return timer_remaining(autoshift_time,
+#ifdef AUTO_SHIFT_TIMEOUT_PER_KEY
+                           get_autoshift_timeout(autoshift_lastkey, &autoshift_lastrecord)
+#else
+                           autoshift_timeout
+#endif
+    );
+}
+
 void autoshift_toggle(void) {
     autoshift_flags.enabled = !autoshift_flags.enabled;
     autoshift_flush_shift();
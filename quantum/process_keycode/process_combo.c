@@ -26,6 +26,7 @@
 #include "action_tapping.h"
 #include "action_util.h"
 #include "action.h"
+#include "debug.h"
 
 #ifdef VIAL_ENABLE
 #include "vial.h"
@@ -50,6 +51,16 @@ combo_t* combo_get(uint16_t combo_idx) {
 #include "keymap_introspection.h"
 #endif
 
+#ifdef COMBO_KEY_INDEX
+#    ifndef COMBO_KEY_INDEX_SIZE
+#        ifdef VIAL_COMBO_ENABLE
+#            define COMBO_KEY_INDEX_SIZE (VIAL_COMBO_ENTRIES * 4)
+#        else
+#            define COMBO_KEY_INDEX_SIZE 64
+#        endif
+#    endif
+#endif
+
 __attribute__((weak)) void process_combo_event(uint16_t combo_index, bool pressed) {}
 
 #ifndef COMBO_ONLY_FROM_LAYER
@@ -279,7 +290,6 @@ static inline void dump_key_buffer(void) {
     key_buffer_next = key_buffer_size = 0;
 }
 
-#define NO_COMBO_KEYS_ARE_DOWN (0 == COMBO_STATE(combo))
 #define ALL_COMBO_KEYS_ARE_DOWN(state, key_count) (((1 << key_count) - 1) == state)
 #define ONLY_ONE_KEY_IS_DOWN(state) !(state & (state - 1))
 #define KEY_NOT_YET_RELEASED(state, key_index) ((1 << key_index) & state)
@@ -301,6 +311,91 @@ static inline void _find_key_index_and_count(const uint16_t *keys, uint16_t keyc
     }
 }
 
+#ifdef COMBO_KEY_INDEX
+/* Index from keycode to the combos containing it, so that a key event only has to visit those
+ * combos. Entries are sorted by keycode and then by combo index, which keeps the combos in the
+ * same order as the linear scan over all combos. */
+typedef struct {
+    uint16_t keycode;
+    uint16_t combo_index;
+    uint8_t  key_index;
+    uint8_t  key_count;
+} combo_key_index_entry_t;
+
+typedef enum {
+    COMBO_KEY_INDEX_STALE,
+    COMBO_KEY_INDEX_VALID,
+    COMBO_KEY_INDEX_OVERFLOW,
+} combo_key_index_status_t;
+
+static combo_key_index_entry_t  combo_key_index[COMBO_KEY_INDEX_SIZE];
+static uint16_t                 combo_key_index_count  = 0;
+static combo_key_index_status_t combo_key_index_status = COMBO_KEY_INDEX_STALE;
+
+void combo_key_index_rebuild(void) {
+    combo_key_index_count  = 0;
+    combo_key_index_status = COMBO_KEY_INDEX_VALID;
+
+    for (uint16_t combo_index = 0; combo_index < combo_count(); ++combo_index) {
+        const uint16_t *keys      = combo_get(combo_index)->keys;
+        uint8_t         key_count = 0;
+        while (pgm_read_word(&keys[key_count]) != COMBO_END) {
+            key_count++;
+        }
+
+        for (uint8_t key_index = 0; key_index < key_count; ++key_index) {
+            uint16_t keycode = pgm_read_word(&keys[key_index]);
+
+            /* A repeated key resolves to its last position, same as _find_key_index_and_count. */
+            bool repeated = false;
+            for (uint8_t i = key_index + 1; i < key_count; ++i) {
+                if (pgm_read_word(&keys[i]) == keycode) {
+                    repeated = true;
+                    break;
+                }
+            }
+            if (repeated) {
+                continue;
+            }
+
+            if (combo_key_index_count >= COMBO_KEY_INDEX_SIZE) {
+                dprintf("combo key index overflow, increase COMBO_KEY_INDEX_SIZE\n");
+                combo_key_index_status = COMBO_KEY_INDEX_OVERFLOW;
+                return;
+            }
+
+            /* Stable insertion by keycode, combos are visited in ascending order. */
+            uint16_t pos = combo_key_index_count++;
+            while (pos > 0 && combo_key_index[pos - 1].keycode > keycode) {
+                combo_key_index[pos] = combo_key_index[pos - 1];
+                pos--;
+            }
+            combo_key_index[pos] = (combo_key_index_entry_t){
+                .keycode     = keycode,
+                .combo_index = combo_index,
+                .key_index   = key_index,
+                .key_count   = key_count,
+            };
+        }
+    }
+}
+
+/* Returns the position of the first index entry for keycode, or where it would be inserted. */
+static uint16_t combo_key_index_find(uint16_t keycode) {
+    uint16_t low  = 0;
+    uint16_t high = combo_key_index_count;
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (combo_key_index[mid].keycode < keycode) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    return low;
+}
+#endif
+
 void drop_combo_from_buffer(uint16_t combo_index) {
     /* Mark a combo as processed from the buffer. If the buffer is in the
      * beginning of the buffer, drop it.  */
@@ -437,16 +532,7 @@ static bool keys_pressed_in_order(uint16_t combo_index, combo_t *combo, uint16_t
 }
 #endif
 
-static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
-    uint8_t  key_count = 0;
-    uint16_t key_index = -1;
-    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
-
-    /* Continue processing if key isn't part of current combo. */
-    if (-1 == (int16_t)key_index) {
-        return false;
-    }
-
+static bool process_combo_key(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index, uint16_t key_index, uint8_t key_count) {
     bool key_is_part_of_combo = (!COMBO_DISABLED(combo) && is_combo_enabled()
 #if defined(COMBO_MUST_PRESS_IN_ORDER) || defined(COMBO_MUST_PRESS_IN_ORDER_PER_COMBO)
                                  && keys_pressed_in_order(combo_index, combo, key_index, keycode, record)
@@ -557,9 +643,21 @@ static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *
     return key_is_part_of_combo;
 }
 
+static bool process_single_combo(combo_t *combo, uint16_t keycode, keyrecord_t *record, uint16_t combo_index) {
+    uint8_t  key_count = 0;
+    uint16_t key_index = -1;
+    _find_key_index_and_count(combo->keys, keycode, &key_index, &key_count);
+
+    /* Continue processing if key isn't part of current combo. */
+    if (-1 == (int16_t)key_index) {
+        return false;
+    }
+
+    return process_combo_key(combo, keycode, record, combo_index, key_index, key_count);
+}
+
 bool process_combo(uint16_t keycode, keyrecord_t *record) {
-    bool is_combo_key          = false;
-    bool no_combo_keys_pressed = true;
+    bool is_combo_key = false;
 
     if (keycode == QK_COMBO_ON && record->event.pressed) {
         combo_enable();
@@ -587,10 +685,22 @@ bool process_combo(uint16_t keycode, keyrecord_t *record) {
     }
 #endif
 
-    for (uint16_t idx = 0; idx < combo_count(); ++idx) {
-        combo_t *combo = combo_get(idx);
-        is_combo_key |= process_single_combo(combo, keycode, record, idx);
-        no_combo_keys_pressed = no_combo_keys_pressed && (NO_COMBO_KEYS_ARE_DOWN || COMBO_ACTIVE(combo) || COMBO_DISABLED(combo));
+#ifdef COMBO_KEY_INDEX
+    if (combo_key_index_status == COMBO_KEY_INDEX_STALE) {
+        combo_key_index_rebuild();
+    }
+
+    if (combo_key_index_status == COMBO_KEY_INDEX_VALID) {
+        for (uint16_t i = combo_key_index_find(keycode); i < combo_key_index_count && combo_key_index[i].keycode == keycode; ++i) {
+            const combo_key_index_entry_t *entry = &combo_key_index[i];
+            is_combo_key |= process_combo_key(combo_get(entry->combo_index), keycode, record, entry->combo_index, entry->key_index, entry->key_count);
+        }
+    } else
+#endif
+    {
+        for (uint16_t idx = 0; idx < combo_count(); ++idx) {
+            is_combo_key |= process_single_combo(combo_get(idx), keycode, record, idx);
+        }
     }
 
     if (record->event.pressed && is_combo_key) {
@@ -648,6 +758,15 @@ void combo_task(void) {
 #endif
 }
 
+uint32_t combo_time_until_next(void) {
+#ifndef COMBO_NO_TIMER
+    if (b_combo_enable && timer) {
+        return timer_remaining(timer, longest_term + 1);
+    }
+#endif
+    return TIMER_NO_DEADLINE;
+}
+
 void combo_enable(void) {
     b_combo_enable = true;
 }
@@ -77,7 +77,13 @@ bool process_combo(uint16_t keycode, keyrecord_t *record);
 void combo_task(void);
 void process_combo_event(uint16_t combo_index, bool pressed);
 
+uint32_t combo_time_until_next(void);
+
 void combo_enable(void);
 void combo_disable(void);
 void combo_toggle(void);
 bool is_combo_enabled(void);
+
+#ifdef COMBO_KEY_INDEX
+void combo_key_index_rebuild(void);
+#endif
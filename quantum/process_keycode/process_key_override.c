@@ -407,6 +407,14 @@ void key_override_task(void) {
     }
 }
 
+uint32_t key_override_time_until_next(void) {
+    if (deferred_register == 0) {
+        return TIMER_NO_DEADLINE;
+    }
+    uint32_t elapsed = timer_elapsed32(defer_reference_time);
+    return elapsed >= defer_delay ? 0 : defer_delay - elapsed;
+}
+
 bool process_key_override(const uint16_t keycode, const keyrecord_t *const record) {
 #ifdef BENCH_KEY_OVERRIDE
     uint16_t start = timer_read();
@@ -108,6 +108,11 @@ bool process_key_override(const uint16_t keycode, const keyrecord_t *const recor
 /** Perform any deferred keys */
 void key_override_task(void);
 
+/**
+ * Milliseconds until a deferred override key is registered, or TIMER_NO_DEADLINE if none is waiting.
+ */
+uint32_t key_override_time_until_next(void);
+
 /**
  *  Preferrably use these macros to create key overrides. They fix many of the options to a standard setting that should satisfy most basic use-cases. Only directly create a key_override_t struct when you really need to.
  */
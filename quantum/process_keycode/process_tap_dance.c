@@ -188,6 +188,17 @@ void tap_dance_task(void) {
     }
 }
 
+uint32_t tap_dance_time_until_next(void) {
+    if (!active_td) {
+        return TIMER_NO_DEADLINE;
+    }
+    // A finished dance is only waiting for its key to be released
+    if (tap_dance_actions[QK_TAP_DANCE_GET_INDEX(active_td)].state.finished) {
+        return TIMER_NO_DEADLINE;
+    }
+    return timer_remaining(last_tap_time, GET_TAPPING_TERM(active_td, &(keyrecord_t){}) + 1);
+}
+
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
     process_tap_dance_action_on_reset((tap_dance_action_t *)state);
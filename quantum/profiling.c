@@ -0,0 +1,82 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <string.h>
+#include "profiling.h"
+#include "debug.h"
+#include "print.h"
+
+static profiling_zone_t zones[PROFILING_MAX_ZONES];
+static uint8_t          zone_count = 0;
+
+profiling_zone_t *profiling_zone_get(const char *name) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        if (strcmp(zones[i].name, name) == 0) {
+            return &zones[i];
+        }
+    }
+    if (zone_count >= PROFILING_MAX_ZONES) {
+        return NULL;
+    }
+
+    profiling_zone_t *zone = &zones[zone_count++];
+    memset(zone, 0, sizeof(profiling_zone_t));
+    zone->name = name;
+    return zone;
+}
+
+void profiling_zone_record(profiling_zone_t *zone, uint32_t cycles) {
+    if (zone == NULL) {
+        return;
+    }
+    if (zone->calls == 0 || cycles < zone->min) {
+        zone->min = cycles;
+    }
+    if (cycles > zone->max) {
+        zone->max = cycles;
+    }
+    zone->calls++;
+    zone->total += cycles;
+}
+
+uint8_t profiling_zone_count(void) {
+    return zone_count;
+}
+
+const profiling_zone_t *profiling_zone_at(uint8_t index) {
+    if (index >= zone_count) {
+        return NULL;
+    }
+    return &zones[index];
+}
+
+void profiling_reset(void) {
+    for (uint8_t i = 0; i < zone_count; i++) {
+        zones[i].calls = 0;
+        zones[i].min   = 0;
+        zones[i].max   = 0;
+        zones[i].total = 0;
+    }
+}
+
+void profiling_print(void) {
+#ifdef CONSOLE_ENABLE
+    for (uint8_t i = 0; i < zone_count; i++) {
+        const profiling_zone_t *zone = &zones[i];
+        uint32_t                avg  = zone->calls ? (uint32_t)(zone->total / zone->calls) : 0;
+        uprintf("%s -- calls: %lu, min: %lu, avg: %lu, max: %lu\n", zone->name, (unsigned long)zone->calls, (unsigned long)zone->min, (unsigned long)avg, (unsigned long)zone->max);
+    }
+#endif
+}
+
+void profiling_task(void) {
+#if PROFILING_PRINT_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= PROFILING_PRINT_INTERVAL) {
+        last_print = timer_read32();
+        if (debug_enable) {
+            profiling_print();
+        }
+    }
+#endif
+}
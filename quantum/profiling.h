@@ -0,0 +1,89 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "timer.h"
+
+/*
+    Registry of named profiling zones, each keeping call count and min/max/total time spent.
+
+    Usage example:
+
+        #include "profiling.h"
+
+        // Original code:
+        matrix_task();
+
+        // Replace with (variant 1, automatic naming):
+        PROFILE_ZONE(matrix_task());
+
+        // Replace with (variant 2, explicit naming):
+        PROFILE_ZONE_NAMED("matrix_task", {
+            matrix_task();
+        });
+
+    Without PROFILING_ENABLE the macros run the wrapped code as-is. Times are measured with
+    timer_read_cycles(), so their unit depends on the platform.
+*/
+
+#ifndef PROFILING_MAX_ZONES
+#    define PROFILING_MAX_ZONES 16
+#endif
+
+// How often the zones are printed to the console, 0 to disable
+#ifndef PROFILING_PRINT_INTERVAL
+#    define PROFILING_PRINT_INTERVAL 10000
+#endif
+
+typedef struct {
+    const char *name;
+    uint32_t    calls;
+    uint32_t    min;
+    uint32_t    max;
+    uint64_t    total;
+} profiling_zone_t;
+
+/** \brief Looks up a zone by name, registering it if needed. Returns NULL once the registry is full. */
+profiling_zone_t *profiling_zone_get(const char *name);
+
+/** \brief Adds one call taking `cycles` to a zone. NULL zones are ignored. */
+void profiling_zone_record(profiling_zone_t *zone, uint32_t cycles);
+
+/** \brief Number of registered zones. */
+uint8_t profiling_zone_count(void);
+
+/** \brief Zone at `index` in registration order, or NULL if out of range. */
+const profiling_zone_t *profiling_zone_at(uint8_t index);
+
+/** \brief Clears the statistics of every zone. Zones stay registered. */
+void profiling_reset(void);
+
+/** \brief Prints every zone to the console. */
+void profiling_print(void);
+
+/** \brief Prints the zones every PROFILING_PRINT_INTERVAL when debugging is enabled. */
+void profiling_task(void);
+
+#ifdef PROFILING_ENABLE
+#    define PROFILE_ZONE_NAMED(name, call)                                            \
+        do {                                                                          \
+            static profiling_zone_t *profile_zone = NULL;                             \
+            if (profile_zone == NULL) {                                               \
+                profile_zone = profiling_zone_get(name);                              \
+            }                                                                         \
+            uint32_t profile_start = timer_read_cycles();                             \
+            do {                                                                      \
+                call;                                                                 \
+            } while (0);                                                              \
+            profiling_zone_record(profile_zone, timer_read_cycles() - profile_start); \
+        } while (0)
+#else
+#    define PROFILE_ZONE_NAMED(name, call) \
+        do {                               \
+            call;                          \
+        } while (0)
+#endif
+
+#define PROFILE_ZONE(call) PROFILE_ZONE_NAMED(#call, call)
@@ -0,0 +1,95 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "profiling.h"
+#include "timer.h"
+
+void advance_time(uint32_t ms);
+void simulate_async_tick(uint32_t t);
+}
+
+class Profiling : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        timer_clear();
+        profiling_reset();
+    }
+};
+
+static void busy_for(uint32_t ms) {
+    advance_time(ms);
+}
+
+TEST_F(Profiling, ZoneRecordsCallsAndTimes) {
+    const uint32_t durations[] = {5, 2, 9};
+    for (uint32_t duration : durations) {
+        PROFILE_ZONE_NAMED("busy", busy_for(duration));
+    }
+
+    profiling_zone_t *zone = profiling_zone_get("busy");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(zone->calls, 3);
+    EXPECT_EQ(zone->min, 2);
+    EXPECT_EQ(zone->max, 9);
+    EXPECT_EQ(zone->total, 16);
+}
+
+TEST_F(Profiling, AutomaticNameIsTheCall) {
+    PROFILE_ZONE(busy_for(1));
+
+    bool found = false;
+    for (uint8_t i = 0; i < profiling_zone_count(); i++) {
+        found |= strcmp(profiling_zone_at(i)->name, "busy_for(1)") == 0;
+    }
+    EXPECT_TRUE(found);
+}
+
+TEST_F(Profiling, SameNameReturnsSameZone) {
+    profiling_zone_t *zone = profiling_zone_get("lookup");
+    ASSERT_NE(zone, nullptr);
+    EXPECT_EQ(profiling_zone_get("lookup"), zone);
+    EXPECT_STREQ(zone->name, "lookup");
+}
+
+TEST_F(Profiling, ResetKeepsZonesRegistered) {
+    profiling_zone_t *zone = profiling_zone_get("reset");
+    profiling_zone_record(zone, 42);
+    uint8_t count = profiling_zone_count();
+
+    profiling_reset();
+    EXPECT_EQ(profiling_zone_count(), count);
+    EXPECT_EQ(profiling_zone_get("reset"), zone);
+    EXPECT_EQ(zone->calls, 0);
+    EXPECT_EQ(zone->max, 0);
+    EXPECT_EQ(zone->total, 0);
+
+    profiling_zone_record(zone, 7);
+    EXPECT_EQ(zone->min, 7);
+}
+
+TEST_F(Profiling, TestTimerCyclesDoNotTickTheClock) {
+    simulate_async_tick(3);
+    uint32_t first = timer_read_cycles();
+    EXPECT_EQ(timer_read_cycles(), first);
+    EXPECT_EQ(timer_read32(), first);
+    EXPECT_EQ(timer_read32(), first + 3);
+    simulate_async_tick(0);
+}
+
+TEST_F(Profiling, FullRegistryIsIgnored) {
+    static const char *names[] = {"full_0", "full_1", "full_2", "full_3", "full_4"};
+    for (const char *name : names) {
+        profiling_zone_get(name);
+    }
+    EXPECT_EQ(profiling_zone_count(), PROFILING_MAX_ZONES);
+    EXPECT_EQ(profiling_zone_get("full_4"), nullptr);
+    EXPECT_EQ(profiling_zone_at(PROFILING_MAX_ZONES), nullptr);
+
+    profiling_zone_record(nullptr, 1);
+    PROFILE_ZONE_NAMED("overflow", busy_for(1));
+    EXPECT_EQ(profiling_zone_count(), PROFILING_MAX_ZONES);
+}
@@ -0,0 +1,8 @@
+profiling_DEFS := -DPROFILING_ENABLE
+profiling_DEFS += -DPROFILING_MAX_ZONES=4
+
+profiling_SRC := \
+    $(QUANTUM_PATH)/profiling/tests/profiling_tests.cpp \
+    $(QUANTUM_PATH)/profiling.c \
+    $(QUANTUM_PATH)/logging/debug.c \
+    $(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
@@ -218,6 +218,14 @@ extern layer_state_t layer_state;
 #    include "mousekey.h"
 #endif
 
+#ifdef KEY_LATENCY_ENABLE
+#    include "key_latency.h"
+#endif
+
+#ifdef PROFILING_ENABLE
+#    include "profiling.h"
+#endif
+
 #ifdef CAPS_WORD_ENABLE
 #    include "caps_word.h"
 #    include "process_caps_word.h"
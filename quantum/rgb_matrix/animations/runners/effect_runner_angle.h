@@ -0,0 +1,22 @@
+#pragma once
+
+typedef HSV (*angle_f)(HSV hsv, uint8_t angle, uint8_t time);
+
+bool effect_runner_angle(effect_params_t* params, angle_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch;
+    batch.count = 0;
+
+    uint8_t time = scale16by8(g_rgb_timer, rgb_matrix_config.speed / 2);
+    for (uint8_t i = led_min; i < led_max; i++) {
+        RGB_MATRIX_TEST_LED_FLAGS();
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+        uint8_t angle = g_led_geometry[i].angle;
+#else
+        uint8_t angle = atan2_8(RGB_MATRIX_LED_DY(i), RGB_MATRIX_LED_DX(i));
+#endif
+        rgb_matrix_batch_set_hsv(&batch, i, effect_func(rgb_matrix_config.hsv, angle, time));
+    }
+    rgb_matrix_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
@@ -6,9 +6,20 @@ typedef HSV (*reactive_f)(HSV hsv, uint16_t offset);
 
 bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch;
+    batch.count = 0;
 
+#    ifndef RGB_MATRIX_KEYREACTIVE_FIELD
     uint16_t max_tick = 65535 / qadd8(rgb_matrix_config.speed, 1);
+#    endif
     for (uint8_t i = led_min; i < led_max; i++) {
+#    ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+        rgb_matrix_reactive_field_update(i, params->init);
+        RGB_MATRIX_TEST_LED_FLAGS();
+        // The field keeps the latest hit of every LED, however many keys were hit since
+        uint16_t offset;
+        if (!rgb_matrix_reactive_field_hit_tick(i, &offset) || offset > 255) offset = 255;
+#    else
         RGB_MATRIX_TEST_LED_FLAGS();
         uint16_t tick = max_tick;
         // Reverse search to find most recent key hit
@@ -20,9 +31,10 @@ bool effect_runner_reactive(effect_params_t* params, reactive_f effect_func) {
         }
 
         uint16_t offset = scale16by8(tick, qadd8(rgb_matrix_config.speed, 1));
-        RGB      rgb    = rgb_matrix_hsv_to_rgb(effect_func(rgb_matrix_config.hsv, offset));
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+#    endif
+        rgb_matrix_batch_set_hsv(&batch, i, effect_func(rgb_matrix_config.hsv, offset));
     }
+    rgb_matrix_batch_flush(&batch);
     return rgb_matrix_check_finished_leds(led_max);
 }
 
@@ -0,0 +1,29 @@
+#pragma once
+
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+
+// Renders the splash rings of every hit at once from the reactive field, instead of each
+// remembered hit for every LED. The field holds the time since the latest ring passed an
+// LED, which is what the effects compute as the tick less the distance to the hit.
+bool effect_runner_reactive_field(effect_params_t* params, reactive_splash_f effect_func) {
+    RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch;
+    batch.count = 0;
+
+    for (uint8_t i = led_min; i < led_max; i++) {
+        rgb_matrix_reactive_field_update(i, params->init);
+        RGB_MATRIX_TEST_LED_FLAGS();
+        HSV      hsv = rgb_matrix_config.hsv;
+        uint16_t tick;
+        hsv.v = 0;
+        if (rgb_matrix_reactive_field_ring_tick(i, &tick)) {
+            hsv = effect_func(hsv, 0, 0, 0, tick);
+        }
+        hsv.v = scale8(hsv.v, rgb_matrix_config.hsv.v);
+        rgb_matrix_batch_set_hsv(&batch, i, hsv);
+    }
+    rgb_matrix_batch_flush(&batch);
+    return rgb_matrix_check_finished_leds(led_max);
+}
+
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
@@ -28,7 +28,11 @@ bool SOLID_SPLASH(effect_params_t* params) {
 
 #            ifdef ENABLE_RGB_MATRIX_SOLID_MULTISPLASH
 bool SOLID_MULTISPLASH(effect_params_t* params) {
+#                ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    return effect_runner_reactive_field(params, &SOLID_SPLASH_math);
+#                else
     return effect_runner_reactive_splash(0, params, &SOLID_SPLASH_math);
+#                endif
 }
 #            endif
 
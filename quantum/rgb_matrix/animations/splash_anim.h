@@ -29,7 +29,11 @@ bool SPLASH(effect_params_t* params) {
 
 #            ifdef ENABLE_RGB_MATRIX_MULTISPLASH
 bool MULTISPLASH(effect_params_t* params) {
+#                ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    return effect_runner_reactive_field(params, &SPLASH_math);
+#                else
     return effect_runner_reactive_splash(0, params, &SPLASH_math);
+#                endif
 }
 #            endif
 
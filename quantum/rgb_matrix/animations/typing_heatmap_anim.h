@@ -17,6 +17,76 @@ RGB_MATRIX_EFFECT(TYPING_HEATMAP)
 #        ifndef RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT
 #            define RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT 16
 #        endif
+
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT
+#            define RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT 0
+#        endif
+
+#        ifndef RGB_MATRIX_TYPING_HEATMAP_SLIM
+// How much a press of the key at row, col heats the key at i_row, i_col, zero if it is out of reach
+static uint8_t typing_heatmap_spread(uint8_t row, uint8_t col, uint8_t i_row, uint8_t i_col) {
+#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
+    uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
+#            undef LED_DISTANCE
+    if (distance > RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+        return 0;
+    }
+    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
+    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
+        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
+    }
+    return amount;
+}
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT > 0
+typedef struct PACKED {
+    uint8_t row;
+    uint8_t col;
+    uint8_t amount;
+} typing_heatmap_neighbor_t;
+
+// The keys within reach of every key and how much they heat up, so that a press does not measure
+// the distance to every other key. The neighbors of key n are typing_heatmap_neighbors from
+// typing_heatmap_neighbor_start[n] up to typing_heatmap_neighbor_start[n + 1].
+static typing_heatmap_neighbor_t typing_heatmap_neighbors[RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT];
+static uint16_t                  typing_heatmap_neighbor_start[MATRIX_ROWS * MATRIX_COLS + 1];
+// Keys from this one on did not fit RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT, or were pressed before
+// the effect started, and still measure distances
+static uint16_t typing_heatmap_neighbor_keys;
+
+// Built when the effect starts, so no key press pays for it
+static void typing_heatmap_update_neighbors(void) {
+    uint16_t count                   = 0;
+    typing_heatmap_neighbor_keys     = 0;
+    typing_heatmap_neighbor_start[0] = 0;
+
+    for (uint16_t key = 0; key < MATRIX_ROWS * MATRIX_COLS; key++) {
+        uint8_t row = key / MATRIX_COLS;
+        uint8_t col = key % MATRIX_COLS;
+        if (g_led_config.matrix_co[row][col] != NO_LED) {
+            for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+                for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                    if (g_led_config.matrix_co[i_row][i_col] == NO_LED || (i_row == row && i_col == col)) {
+                        continue;
+                    }
+                    uint8_t amount = typing_heatmap_spread(row, col, i_row, i_col);
+                    if (!amount) {
+                        continue;
+                    }
+                    if (count == RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT) {
+                        return;
+                    }
+                    typing_heatmap_neighbors[count++] = (typing_heatmap_neighbor_t){i_row, i_col, amount};
+                }
+            }
+        }
+        typing_heatmap_neighbor_start[key + 1] = count;
+        typing_heatmap_neighbor_keys           = key + 1;
+    }
+}
+#            endif // RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT > 0
+#        endif     // RGB_MATRIX_TYPING_HEATMAP_SLIM
+
 void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
 #        ifdef RGB_MATRIX_TYPING_HEATMAP_SLIM
     // Limit effect to pressed keys
@@ -25,25 +95,25 @@ void process_rgb_matrix_typing_heatmap(uint8_t row, uint8_t col) {
     if (g_led_config.matrix_co[row][col] == NO_LED) { // skip as pressed key doesn't have an led position
         return;
     }
+    g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+
+#            if RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT > 0
+    uint16_t key = row * MATRIX_COLS + col;
+    if (key < typing_heatmap_neighbor_keys) {
+        for (uint16_t i = typing_heatmap_neighbor_start[key]; i < typing_heatmap_neighbor_start[key + 1]; i++) {
+            typing_heatmap_neighbor_t neighbor             = typing_heatmap_neighbors[i];
+            g_rgb_frame_buffer[neighbor.row][neighbor.col] = qadd8(g_rgb_frame_buffer[neighbor.row][neighbor.col], neighbor.amount);
+        }
+        return;
+    }
+#            endif // RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT > 0
+
     for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
         for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
-            if (g_led_config.matrix_co[i_row][i_col] == NO_LED) { // skip as target key doesn't have an led position
+            if (g_led_config.matrix_co[i_row][i_col] == NO_LED || (i_row == row && i_col == col)) { // skip as target key doesn't have an led position
                 continue;
             }
-            if (i_row == row && i_col == col) {
-                g_rgb_frame_buffer[row][col] = qadd8(g_rgb_frame_buffer[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
-            } else {
-#            define LED_DISTANCE(led_a, led_b) sqrt16(((int16_t)(led_a.x - led_b.x) * (int16_t)(led_a.x - led_b.x)) + ((int16_t)(led_a.y - led_b.y) * (int16_t)(led_a.y - led_b.y)))
-                uint8_t distance = LED_DISTANCE(g_led_config.point[g_led_config.matrix_co[row][col]], g_led_config.point[g_led_config.matrix_co[i_row][i_col]]);
-#            undef LED_DISTANCE
-                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
-                    uint8_t amount = qsub8(RGB_MATRIX_TYPING_HEATMAP_SPREAD, distance);
-                    if (amount > RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT) {
-                        amount = RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT;
-                    }
-                    g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], amount);
-                }
-            }
+            g_rgb_frame_buffer[i_row][i_col] = qadd8(g_rgb_frame_buffer[i_row][i_col], typing_heatmap_spread(row, col, i_row, i_col));
         }
     }
 #        endif
@@ -60,6 +130,9 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     if (params->init) {
         rgb_matrix_set_color_all(0, 0, 0);
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+#        if !defined(RGB_MATRIX_TYPING_HEATMAP_SLIM) && RGB_MATRIX_TYPING_HEATMAP_NEIGHBOR_LIMIT > 0
+        typing_heatmap_update_neighbors();
+#        endif
     }
 
     // The heatmap animation might run in several iterations depending on
@@ -74,22 +147,34 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         }
     }
 
+    // Most keys are cold, they all share a single color
+    RGB  cold      = {0};
+    bool cold_done = false;
+
     // Render heatmap & decrease
     uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
+    for (uint8_t row = 0; row < MATRIX_ROWS && count < led_max - led_min; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && count < led_max - led_min; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
                 uint8_t val = g_rgb_frame_buffer[row][col];
                 if (!HAS_ANY_FLAGS(g_led_config.flags[g_led_config.matrix_co[row][col]], params->flags)) continue;
 
-                HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
-                RGB rgb = rgb_matrix_hsv_to_rgb(hsv);
-                rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
-
-                if (decrease_heatmap_values) {
-                    g_rgb_frame_buffer[row][col] = qsub8(val, 1);
+                RGB rgb;
+                if (val) {
+                    HSV hsv = {170 - qsub8(val, 85), rgb_matrix_config.hsv.s, scale8((qadd8(170, val) - 170) * 3, rgb_matrix_config.hsv.v)};
+                    rgb     = rgb_matrix_hsv_to_rgb(hsv);
+                    if (decrease_heatmap_values) {
+                        g_rgb_frame_buffer[row][col] = val - 1;
+                    }
+                } else {
+                    if (!cold_done) {
+                        cold      = rgb_matrix_hsv_to_rgb((HSV){170, rgb_matrix_config.hsv.s, 0});
+                        cold_done = true;
+                    }
+                    rgb = cold;
                 }
+                rgb_matrix_set_color(g_led_config.matrix_co[row][col], rgb.r, rgb.g, rgb.b);
             }
         }
     }
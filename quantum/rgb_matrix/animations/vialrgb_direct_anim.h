@@ -1,17 +1,33 @@
 #if defined(VIALRGB_ENABLE) && !defined(VIALRGB_NO_DIRECT)
 #define RGB_MATRIX_EFFECT_VIALRGB_DIRECT
 RGB_MATRIX_EFFECT(VIALRGB_DIRECT)
+// Streaming keeps two more frames of LEDs, which is left to the boards that ask for it on AVR
+#    if !defined(VIALRGB_NO_STREAM) && (!defined(__AVR__) || defined(VIALRGB_STREAM))
+#        define VIALRGB_DIRECT_STREAM
+#    endif
 #    ifdef RGB_MATRIX_CUSTOM_EFFECT_IMPLS
 
 extern HSV g_direct_mode_colors[RGB_MATRIX_LED_COUNT];
+#        ifdef VIALRGB_DIRECT_STREAM
+void vialrgb_direct_frame_start(void);
+#        endif
 
 bool VIALRGB_DIRECT(effect_params_t* params) {
     RGB_MATRIX_USE_LIMITS(led_min, led_max);
+    rgb_matrix_hsv_batch_t batch;
+    batch.count = 0;
+
+#        ifdef VIALRGB_DIRECT_STREAM
+    // Committed frames only replace the colors between rendered frames, so that they never tear
+    if (params->iter == 0) {
+        vialrgb_direct_frame_start();
+    }
+#        endif
 
     for (uint8_t i = led_min; i < led_max; i++) {
-        RGB rgb = rgb_matrix_hsv_to_rgb(g_direct_mode_colors[i]);
-        rgb_matrix_set_color(i, rgb.r, rgb.g, rgb.b);
+        rgb_matrix_batch_set_hsv(&batch, i, g_direct_mode_colors[i]);
     }
+    rgb_matrix_batch_flush(&batch);
     return led_max < RGB_MATRIX_LED_COUNT;
 }
 #    endif
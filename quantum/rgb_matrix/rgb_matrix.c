@@ -35,10 +35,42 @@ const led_point_t k_rgb_matrix_center = {112, 32};
 const led_point_t k_rgb_matrix_center = RGB_MATRIX_CENTER;
 #endif
 
-__attribute__((weak)) RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+static RGB rgb_matrix_hsv_to_rgb_default(HSV hsv) {
     return hsv_to_rgb(hsv);
 }
 
+// Aliased rather than defined directly, so the batch below can tell whether it has been overridden
+RGB rgb_matrix_hsv_to_rgb(HSV hsv) __attribute__((weak, alias("rgb_matrix_hsv_to_rgb_default")));
+
+// Used by the effect runners, takes the batched fast path unless rgb_matrix_hsv_to_rgb() has been overridden
+__attribute__((weak)) void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count) {
+    if (rgb_matrix_hsv_to_rgb == rgb_matrix_hsv_to_rgb_default) {
+        hsv_to_rgb_batch(hsv, rgb, count);
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        rgb[i] = rgb_matrix_hsv_to_rgb(hsv[i]);
+    }
+}
+
+void rgb_matrix_batch_flush(rgb_matrix_hsv_batch_t *batch) {
+    RGB rgb[RGB_MATRIX_HSV_BATCH_SIZE];
+
+    rgb_matrix_hsv_to_rgb_batch(batch->hsv, rgb, batch->count);
+    for (uint8_t i = 0; i < batch->count; i++) {
+        rgb_matrix_set_color(batch->index[i], rgb[i].r, rgb[i].g, rgb[i].b);
+    }
+    batch->count = 0;
+}
+
+void rgb_matrix_batch_set_hsv(rgb_matrix_hsv_batch_t *batch, uint8_t index, HSV hsv) {
+    batch->index[batch->count] = index;
+    batch->hsv[batch->count]   = hsv;
+    if (++batch->count == RGB_MATRIX_HSV_BATCH_SIZE) {
+        rgb_matrix_batch_flush(batch);
+    }
+}
+
 // Generic effect runners
 #include "rgb_matrix_runners.inc"
 
@@ -69,6 +101,9 @@ uint8_t g_rgb_frame_buffer[MATRIX_ROWS][MATRIX_COLS] = {{0}};
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 last_hit_t g_last_hit_tracker;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif // RGB_MATRIX_GEOMETRY_CACHE
 
 // internals
 static bool            suspend_state     = false;
@@ -83,11 +118,43 @@ static uint32_t rgb_timer_buffer;
 static last_hit_t last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+// Times in the field are in the units of the reactive effects' tick, which runs at the effect speed
+static uint32_t rgb_field_clock_buffer; // field time with 8 fractional bits
+static uint16_t rgb_field_now;          // field time of the frame being rendered
+static uint16_t rgb_field_hit[RGB_MATRIX_LED_COUNT];    // latest hit of every LED
+static uint16_t rgb_field_ring[RGB_MATRIX_LED_COUNT];   // hit that sent the latest splash ring to reach every LED
+static uint16_t rgb_field_travel[RGB_MATRIX_LED_COUNT]; // distance that ring travelled to reach the LED
+// Nearest LEDs of every LED, which the splash rings travel through
+static uint8_t rgb_field_neighbor[RGB_MATRIX_LED_COUNT][RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS];
+static uint8_t rgb_field_distance[RGB_MATRIX_LED_COUNT][RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS];
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
+
 // split rgb matrix
 #if defined(RGB_MATRIX_SPLIT)
 const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
 #endif
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+// Length of the windows over which the rate of timer_read_cycles() is measured
+#    define RGB_MATRIX_RENDER_CALIBRATION_MS 256
+
+// adaptive render slices
+static struct rgb_matrix_limits_t rgb_slice;              // LEDs of the slice being rendered
+static uint8_t                    rgb_slice_next;         // first LED of the next slice
+static uint32_t                   rgb_slice_cost;         // cycles per LED of the current effect with 8 fractional bits, zero until measured
+static uint32_t                   rgb_slice_budget;       // RGB_MATRIX_RENDER_BUDGET_US in cycles with 8 fractional bits, zero until calibrated
+static uint32_t                   rgb_cycles_per_ms;      // rate of timer_read_cycles(), zero until calibrated
+static uint32_t                   rgb_calibration_ms;     // start of the current calibration window
+static uint32_t                   rgb_calibration_cycles; // timer_read_cycles() at the start of the window
+
+// render statistics
+static rgb_matrix_render_stats_t rgb_render_stats;
+static uint32_t                  rgb_stats_start;
+static uint16_t                  rgb_stats_frames;
+static uint32_t                  rgb_stats_max_stall;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 EECONFIG_DEBOUNCE_HELPER(rgb_matrix, EECONFIG_RGB_MATRIX, rgb_matrix_config);
 
 void eeconfig_update_rgb_matrix(void) {
@@ -190,7 +257,15 @@ void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed) {
         last_hit_buffer.tick[index]  = 0;
         last_hit_buffer.count++;
     }
-#endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+#    ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    for (uint8_t i = 0; i < led_count; i++) {
+        rgb_field_hit[led[i]]    = rgb_field_now;
+        rgb_field_ring[led[i]]   = rgb_field_now;
+        rgb_field_travel[led[i]] = 0;
+    }
+#    endif // RGB_MATRIX_KEYREACTIVE_FIELD
+#endif     // RGB_MATRIX_KEYREACTIVE_ENABLED
 
 #if defined(RGB_MATRIX_FRAMEBUFFER_EFFECTS) && defined(ENABLE_RGB_MATRIX_TYPING_HEATMAP)
 #    if defined(RGB_MATRIX_KEYRELEASES)
@@ -256,6 +331,10 @@ static void rgb_task_timers(void) {
         last_hit_buffer.tick[i] += deltaTime;
     }
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    rgb_field_clock_buffer += deltaTime * qadd8(rgb_matrix_config.speed, 1);
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
 }
 
 static void rgb_task_sync(void) {
@@ -264,15 +343,99 @@ static void rgb_task_sync(void) {
     if (sync_timer_elapsed32(g_rgb_timer) >= RGB_MATRIX_LED_FLUSH_LIMIT) rgb_task_state = STARTING;
 }
 
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+static uint8_t rgb_slice_frame_end(void) {
+#    if defined(RGB_MATRIX_SPLIT)
+    if (is_keyboard_left()) return k_rgb_matrix_split[0];
+#    endif
+    return RGB_MATRIX_LED_COUNT;
+}
+
+static void rgb_slice_start_frame(void) {
+    rgb_slice_next = 0;
+#    if defined(RGB_MATRIX_SPLIT)
+    if (!is_keyboard_left()) rgb_slice_next = k_rgb_matrix_split[0];
+#    endif
+
+    // The unit of timer_read_cycles() differs between platforms, so measure it against the millisecond timer
+    uint32_t now_ms     = timer_read32();
+    uint32_t now_cycles = timer_read_cycles();
+    uint32_t elapsed    = TIMER_DIFF_32(now_ms, rgb_calibration_ms);
+    if (elapsed < RGB_MATRIX_RENDER_CALIBRATION_MS) return;
+
+    // The cycle counter may have wrapped during longer gaps, such as while suspended
+    if (elapsed < 4 * RGB_MATRIX_RENDER_CALIBRATION_MS) {
+        rgb_cycles_per_ms = TIMER_DIFF_32(now_cycles, rgb_calibration_cycles) / elapsed;
+        uint64_t budget   = ((uint64_t)RGB_MATRIX_RENDER_BUDGET_US * rgb_cycles_per_ms << 8) / 1000;
+        rgb_slice_budget  = budget > UINT32_MAX ? UINT32_MAX : (uint32_t)budget;
+    }
+    rgb_calibration_ms     = now_ms;
+    rgb_calibration_cycles = now_cycles;
+}
+
+static void rgb_slice_prepare(void) {
+    // Effects are often more expensive while initializing, measure them from their first regular frame
+    if (rgb_effect_params.init) rgb_slice_cost = 0;
+
+    uint8_t  remaining = rgb_slice_next < rgb_slice_frame_end() ? rgb_slice_frame_end() - rgb_slice_next : 0;
+    uint32_t count     = RGB_MATRIX_LED_PROCESS_LIMIT;
+    if (rgb_slice_cost && rgb_slice_budget) {
+        count = rgb_slice_budget / rgb_slice_cost;
+        if (count == 0) count = 1;
+    }
+    if (count > remaining) count = remaining;
+
+    rgb_slice.led_min_index = rgb_slice_next;
+    rgb_slice.led_max_index = rgb_slice_next + count;
+    rgb_slice_next          = rgb_slice.led_max_index;
+}
+
+static void rgb_slice_measure(uint32_t cycles) {
+    uint8_t leds = rgb_slice.led_max_index - rgb_slice.led_min_index;
+    if (!leds) return;
+
+    uint32_t cost = cycles < (UINT32_MAX >> 8) ? (cycles << 8) / leds : UINT32_MAX / leds;
+    // Slices too quick to register on the counter still count, so that the next one grows
+    if (cost == 0) cost = 1;
+    rgb_slice_cost = rgb_slice_cost ? (rgb_slice_cost * 3 + cost) / 4 : cost;
+}
+
+static void rgb_render_stats_record(uint32_t cycles) {
+    if (cycles > rgb_stats_max_stall) rgb_stats_max_stall = cycles;
+
+    uint32_t elapsed = timer_elapsed32(rgb_stats_start);
+    if (elapsed < RGB_MATRIX_RENDER_STATS_INTERVAL) return;
+
+    rgb_render_stats.fps          = (uint32_t)rgb_stats_frames * 1000 / elapsed;
+    rgb_render_stats.slice_leds   = rgb_slice.led_max_index - rgb_slice.led_min_index;
+    rgb_render_stats.max_stall_us = rgb_cycles_per_ms ? (uint32_t)((uint64_t)rgb_stats_max_stall * 1000 / rgb_cycles_per_ms) : 0;
+    dprintf("rgb_matrix: %u fps, %u LEDs per slice, worst stall %lu us\n", rgb_render_stats.fps, rgb_render_stats.slice_leds, (unsigned long)rgb_render_stats.max_stall_us);
+
+    rgb_stats_start     = timer_read32();
+    rgb_stats_frames    = 0;
+    rgb_stats_max_stall = 0;
+}
+
+const rgb_matrix_render_stats_t *rgb_matrix_get_render_stats(void) {
+    return &rgb_render_stats;
+}
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_slice_start_frame();
+#endif
 
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker = last_hit_buffer;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    rgb_field_now = rgb_field_clock_buffer >> 8;
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
 
     // next task
     rgb_task_state = RENDERING;
@@ -285,6 +448,9 @@ static void rgb_task_render(uint8_t effect) {
         rgb_effect_params.flags = rgb_matrix_config.flags;
         rgb_matrix_set_color_all(0, 0, 0);
     }
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_slice_prepare();
+#endif
 
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
@@ -345,12 +511,18 @@ static void rgb_task_flush(uint8_t effect) {
 
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_stats_frames++;
+#endif
 
     // next task
     rgb_task_state = SYNCING;
 }
 
 void rgb_matrix_task(void) {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    uint32_t task_start = timer_read_cycles();
+#endif
     rgb_task_timers();
 
     // Ideally we would also stop sending zeros to the LED driver PWM buffers
@@ -367,7 +539,10 @@ void rgb_matrix_task(void) {
         case STARTING:
             rgb_task_start();
             break;
-        case RENDERING:
+        case RENDERING: {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            uint32_t render_start = timer_read_cycles();
+#endif
             rgb_task_render(effect);
             if (effect) {
                 if (rgb_task_state == FLUSHING) { // ensure we only draw basic indicators once rendering is finished
@@ -375,7 +550,11 @@ void rgb_matrix_task(void) {
                 }
                 rgb_matrix_indicators_advanced(&rgb_effect_params);
             }
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+            rgb_slice_measure(TIMER_DIFF_32(timer_read_cycles(), render_start));
+#endif
             break;
+        }
         case FLUSHING:
             rgb_task_flush(effect);
             break;
@@ -383,6 +562,18 @@ void rgb_matrix_task(void) {
             rgb_task_sync();
             break;
     }
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    rgb_render_stats_record(TIMER_DIFF_32(timer_read_cycles(), task_start));
+#endif
+}
+
+uint32_t rgb_matrix_time_until_next(void) {
+    // Rendering and flushing are spread over consecutive task runs, only the wait for the next frame is idle
+    if (rgb_task_state != SYNCING) {
+        return 0;
+    }
+    uint32_t elapsed = sync_timer_elapsed32(g_rgb_timer);
+    return elapsed >= RGB_MATRIX_LED_FLUSH_LIMIT ? 0 : RGB_MATRIX_LED_FLUSH_LIMIT - elapsed;
 }
 
 void rgb_matrix_indicators(void) {
@@ -398,33 +589,40 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 }
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+    // Slices vary in size, so they are only known while rendering. Effects ask for the current iter
+    // and rgb_matrix_indicators_advanced() for the one just rendered, both are the latest slice.
+    (void)iter;
+    return rgb_slice;
+#else
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
-#    if defined(RGB_MATRIX_SPLIT)
+#    if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
+#        if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
     uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
+#        else
     limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
     limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
     if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
-#else
-#    if defined(RGB_MATRIX_SPLIT)
+#        endif
+#    else
+#        if defined(RGB_MATRIX_SPLIT)
     limits.led_min_index                = 0;
     limits.led_max_index                = RGB_MATRIX_LED_COUNT;
     const uint8_t k_rgb_matrix_split[2] = RGB_MATRIX_SPLIT;
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
+#        else
     limits.led_min_index = 0;
     limits.led_max_index = RGB_MATRIX_LED_COUNT;
+#        endif
 #    endif
-#endif
     return limits;
+#endif
 }
 
 void rgb_matrix_indicators_advanced(effect_params_t *params) {
@@ -445,9 +643,109 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
     return true;
 }
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+void rgb_matrix_update_geometry(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        int16_t dx = g_led_config.point[i].x - k_rgb_matrix_center.x;
+        int16_t dy = g_led_config.point[i].y - k_rgb_matrix_center.y;
+
+        g_led_geometry[i].dx    = dx;
+        g_led_geometry[i].dy    = dy;
+        g_led_geometry[i].dist  = sqrt16(dx * dx + dy * dy);
+        g_led_geometry[i].angle = atan2_8(dy, dx);
+    }
+}
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+// Field entries older than this are no longer shown, and are kept at this age so that they never wrap around
+#    define RGB_FIELD_MAX_AGE INT16_MAX
+
+void rgb_matrix_update_reactive_field(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        uint8_t count = 0;
+        for (uint8_t j = 0; j < RGB_MATRIX_LED_COUNT; j++) {
+            if (i == j) continue;
+            int16_t dx   = g_led_config.point[j].x - g_led_config.point[i].x;
+            int16_t dy   = g_led_config.point[j].y - g_led_config.point[i].y;
+            uint8_t dist = sqrt16(dx * dx + dy * dy);
+
+            // Insertion into the nearest LEDs found so far, which are sorted by distance
+            uint8_t k = count < RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS ? count++ : RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS;
+            for (; k > 0 && rgb_field_distance[i][k - 1] > dist; k--) {
+                if (k < RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS) {
+                    rgb_field_neighbor[i][k] = rgb_field_neighbor[i][k - 1];
+                    rgb_field_distance[i][k] = rgb_field_distance[i][k - 1];
+                }
+            }
+            if (k < RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS) {
+                rgb_field_neighbor[i][k] = j;
+                rgb_field_distance[i][k] = dist;
+            }
+        }
+        for (; count < RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS; count++) {
+            rgb_field_neighbor[i][count] = NO_LED;
+        }
+    }
+}
+
+static inline uint16_t rgb_field_age(uint16_t time) {
+    return rgb_field_now - time;
+}
+
+void rgb_matrix_reactive_field_update(uint8_t led, bool init) {
+    if (init || rgb_field_age(rgb_field_hit[led]) > RGB_FIELD_MAX_AGE) {
+        rgb_field_hit[led] = rgb_field_now - RGB_FIELD_MAX_AGE;
+    }
+    if (init || rgb_field_age(rgb_field_ring[led]) > RGB_FIELD_MAX_AGE) {
+        rgb_field_ring[led]   = rgb_field_now - RGB_FIELD_MAX_AGE;
+        rgb_field_travel[led] = 0;
+    }
+    if (init) {
+        return;
+    }
+
+    // Rings travel outwards through the nearest LEDs. Where rings of several hits meet, the
+    // latest hit wins, and a ring takes the shortest way so that it never comes back.
+    for (uint8_t k = 0; k < RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS && rgb_field_neighbor[led][k] != NO_LED; k++) {
+        uint8_t  neighbor = rgb_field_neighbor[led][k];
+        uint16_t travel   = rgb_field_travel[neighbor] + rgb_field_distance[led][k];
+        uint16_t age      = rgb_field_age(rgb_field_ring[neighbor]);
+        if (age >= RGB_FIELD_MAX_AGE || age < travel) {
+            continue;
+        }
+        if (age < rgb_field_age(rgb_field_ring[led]) || (rgb_field_ring[neighbor] == rgb_field_ring[led] && travel < rgb_field_travel[led])) {
+            rgb_field_ring[led]   = rgb_field_ring[neighbor];
+            rgb_field_travel[led] = travel;
+        }
+    }
+}
+
+bool rgb_matrix_reactive_field_hit_tick(uint8_t led, uint16_t *tick) {
+    *tick = rgb_field_age(rgb_field_hit[led]);
+    return *tick < RGB_FIELD_MAX_AGE;
+}
+
+bool rgb_matrix_reactive_field_ring_tick(uint8_t led, uint16_t *tick) {
+    uint16_t age = rgb_field_age(rgb_field_ring[led]);
+    *tick        = age - rgb_field_travel[led];
+    return age < RGB_FIELD_MAX_AGE;
+}
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
+
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    rgb_matrix_update_geometry();
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+    rgb_matrix_update_reactive_field();
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        rgb_matrix_reactive_field_update(i, true);
+    }
+#endif // RGB_MATRIX_KEYREACTIVE_FIELD
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
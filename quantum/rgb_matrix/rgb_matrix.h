@@ -90,6 +90,10 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#if defined(RGB_MATRIX_RENDER_BUDGET_US) && !defined(RGB_MATRIX_RENDER_STATS_INTERVAL)
+#    define RGB_MATRIX_RENDER_STATS_INTERVAL 5000
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
@@ -114,6 +118,14 @@ struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
 #define RGB_MATRIX_TEST_LED_FLAGS() \
     if (!HAS_ANY_FLAGS(g_led_config.flags[i], params->flags)) continue
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+#    define RGB_MATRIX_LED_DX(i) (g_led_geometry[i].dx)
+#    define RGB_MATRIX_LED_DY(i) (g_led_geometry[i].dy)
+#else
+#    define RGB_MATRIX_LED_DX(i) (g_led_config.point[i].x - k_rgb_matrix_center.x)
+#    define RGB_MATRIX_LED_DY(i) (g_led_config.point[i].y - k_rgb_matrix_center.y)
+#endif
+
 enum rgb_matrix_effects {
     RGB_MATRIX_NONE = 0,
 
@@ -148,9 +160,17 @@ uint8_t rgb_matrix_map_row_column_to_led(uint8_t row, uint8_t column, uint8_t *l
 void rgb_matrix_set_color(int index, uint8_t red, uint8_t green, uint8_t blue);
 void rgb_matrix_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 
+void rgb_matrix_hsv_to_rgb_batch(const HSV *hsv, RGB *rgb, uint8_t count);
+void rgb_matrix_batch_set_hsv(rgb_matrix_hsv_batch_t *batch, uint8_t index, HSV hsv);
+void rgb_matrix_batch_flush(rgb_matrix_hsv_batch_t *batch);
+
 void rgb_matrix_handle_key_event(uint8_t row, uint8_t col, bool pressed);
 
-void rgb_matrix_task(void);
+void     rgb_matrix_task(void);
+uint32_t rgb_matrix_time_until_next(void);
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+const rgb_matrix_render_stats_t *rgb_matrix_get_render_stats(void);
+#endif
 
 // This runs after another backlight effect and replaces
 // colors already set
@@ -163,6 +183,15 @@ bool rgb_matrix_indicators_advanced_kb(uint8_t led_min, uint8_t led_max);
 bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max);
 
 void rgb_matrix_init(void);
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+void rgb_matrix_update_geometry(void);
+#endif
+#ifdef RGB_MATRIX_KEYREACTIVE_FIELD
+void rgb_matrix_update_reactive_field(void);
+void rgb_matrix_reactive_field_update(uint8_t led, bool init);
+bool rgb_matrix_reactive_field_hit_tick(uint8_t led, uint16_t *tick);
+bool rgb_matrix_reactive_field_ring_tick(uint8_t led, uint16_t *tick);
+#endif
 
 void rgb_matrix_reload_from_eeprom(void);
 
@@ -269,8 +298,12 @@ static inline bool rgb_matrix_check_finished_leds(uint8_t led_idx) {
 
 extern rgb_config_t rgb_matrix_config;
 
-extern uint32_t     g_rgb_timer;
-extern led_config_t g_led_config;
+extern uint32_t          g_rgb_timer;
+extern led_config_t      g_led_config;
+extern const led_point_t k_rgb_matrix_center;
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+extern led_geometry_t g_led_geometry[RGB_MATRIX_LED_COUNT];
+#endif
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
 extern last_hit_t g_last_hit_tracker;
 #endif
@@ -21,10 +21,23 @@
 #include "color.h"
 #include "util.h"
 
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
 #if defined(RGB_MATRIX_KEYPRESSES) || defined(RGB_MATRIX_KEYRELEASES)
 #    define RGB_MATRIX_KEYREACTIVE_ENABLED
 #endif
 
+// The reactive field only has something to react to when the reactive effects are enabled, so it is dropped otherwise
+#if defined(RGB_MATRIX_KEYREACTIVE_FIELD) && !defined(RGB_MATRIX_KEYREACTIVE_ENABLED)
+#    undef RGB_MATRIX_KEYREACTIVE_FIELD
+#endif
+
+#if defined(RGB_MATRIX_KEYREACTIVE_FIELD) && !defined(RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS)
+#    define RGB_MATRIX_KEYREACTIVE_FIELD_NEIGHBORS 8
+#endif
+
 // Last led hit
 #ifndef LED_HITS_TO_REMEMBER
 #    define LED_HITS_TO_REMEMBER 8
@@ -40,6 +53,17 @@ typedef struct PACKED {
 } last_hit_t;
 #endif // RGB_MATRIX_KEYREACTIVE_ENABLED
 
+// Number of LEDs whose colors are converted from HSV together by the effect runners
+#ifndef RGB_MATRIX_HSV_BATCH_SIZE
+#    define RGB_MATRIX_HSV_BATCH_SIZE 16
+#endif // RGB_MATRIX_HSV_BATCH_SIZE
+
+typedef struct PACKED {
+    uint8_t count;
+    uint8_t index[RGB_MATRIX_HSV_BATCH_SIZE];
+    HSV     hsv[RGB_MATRIX_HSV_BATCH_SIZE];
+} rgb_matrix_hsv_batch_t;
+
 typedef enum rgb_task_states { STARTING, RENDERING, FLUSHING, SYNCING } rgb_task_states;
 
 typedef uint8_t led_flags_t;
@@ -55,6 +79,24 @@ typedef struct PACKED {
     uint8_t y;
 } led_point_t;
 
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+// Position of an LED relative to the center of the matrix
+typedef struct PACKED {
+    int16_t dx;
+    int16_t dy;
+    uint8_t dist;
+    uint8_t angle;
+} led_geometry_t;
+#endif // RGB_MATRIX_GEOMETRY_CACHE
+
+#ifdef RGB_MATRIX_RENDER_BUDGET_US
+typedef struct {
+    uint16_t fps;          // frames flushed per second
+    uint8_t  slice_leds;   // LEDs rendered by the latest slice
+    uint32_t max_stall_us; // longest single rgb_matrix_task() run
+} rgb_matrix_render_stats_t;
+#endif // RGB_MATRIX_RENDER_BUDGET_US
+
 #define HAS_FLAGS(bits, flags) ((bits & flags) == flags)
 #define HAS_ANY_FLAGS(bits, flags) ((bits & flags) != 0x00)
 
@@ -1532,6 +1532,21 @@ void rgblight_task(void) {
 #endif
 }
 
+uint32_t rgblight_time_until_next(void) {
+#ifdef RGBLIGHT_USE_TIMER
+    // Animation intervals vary per mode, so keep polling while one is running
+    if (rgblight_status.timer_enabled) {
+        return 0;
+    }
+#endif
+#ifdef VELOCIKEY_ENABLE
+    if (rgblight_velocikey_enabled()) {
+        return 0;
+    }
+#endif
+    return TIMER_NO_DEADLINE;
+}
+
 #ifdef VELOCIKEY_ENABLE
 #    define TYPING_SPEED_MAX_VALUE 200
 
@@ -387,7 +387,8 @@ void rgblight_mode_eeprom_helper(uint8_t mode, bool write_to_eeprom);
 void rgblight_show_solid_color(uint8_t r, uint8_t g, uint8_t b);
 
 void preprocess_rgblight(void);
-void rgblight_task(void);
+void     rgblight_task(void);
+uint32_t rgblight_time_until_next(void);
 
 #ifdef RGBLIGHT_USE_TIMER
 void rgblight_timer_init(void);
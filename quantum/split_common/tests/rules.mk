@@ -0,0 +1,52 @@
+split_transactions_DEFS := \
+	-DSPLIT_KEYBOARD \
+	-DMATRIX_ROWS=8 \
+	-DMATRIX_COLS=6 \
+	-DSPLIT_LED_STATE_ENABLE \
+	-DSPLIT_MODS_ENABLE \
+	-DNO_ACTION_ONESHOT
+split_transactions_INC := $(QUANTUM_PATH)/split_common $(PLATFORM_PATH)/test/drivers
+
+split_transactions_SRC := \
+	platforms/test/timer.c \
+	$(PLATFORM_PATH)/test/drivers/serial_loopback.c \
+	$(QUANTUM_PATH)/split_common/tests/split_transactions_tests.cpp \
+	$(QUANTUM_PATH)/split_common/transactions.c \
+	$(QUANTUM_PATH)/split_common/transport.c \
+	$(QUANTUM_PATH)/sync_timer.c \
+	$(QUANTUM_PATH)/crc.c
+
+split_transactions_batch_DEFS := $(split_transactions_DEFS) -DSPLIT_TRANSPORT_BATCH
+split_transactions_batch_INC := $(split_transactions_INC)
+split_transactions_batch_SRC := $(split_transactions_SRC)
+
+split_transactions_push_DEFS := $(split_transactions_DEFS) -DSPLIT_TRANSPORT_PUSH -DSPLIT_PUSH_MAX_STALENESS_MS=10
+split_transactions_push_INC := $(split_transactions_INC)
+split_transactions_push_SRC := $(split_transactions_SRC)
+
+split_transactions_batch_push_DEFS := $(split_transactions_push_DEFS) -DSPLIT_TRANSPORT_BATCH
+split_transactions_batch_push_INC := $(split_transactions_INC)
+split_transactions_batch_push_SRC := $(split_transactions_SRC)
+
+split_transactions_stats_DEFS := $(split_transactions_DEFS) -DSPLIT_TRANSPORT_STATS
+split_transactions_stats_INC := $(split_transactions_INC)
+split_transactions_stats_SRC := $(split_transactions_SRC)
+
+split_transactions_stream_DEFS := $(split_transactions_DEFS) -DSPLIT_STREAM_ENABLE -DDEFERRED_EXEC_ENABLE -DSPLIT_TRANSACTION_IDS_USER=USER_STREAM,USER_SNAPSHOT
+split_transactions_stream_INC := $(split_transactions_INC)
+split_transactions_stream_SRC := $(split_transactions_SRC) $(QUANTUM_PATH)/deferred_exec.c
+
+split_transactions_delta_DEFS := \
+	-DSPLIT_KEYBOARD \
+	-DMATRIX_ROWS=16 \
+	-DMATRIX_COLS=16 \
+	-DSPLIT_LED_STATE_ENABLE \
+	-DSPLIT_MODS_ENABLE \
+	-DNO_ACTION_ONESHOT \
+	-DPOINTING_DEVICE_ENABLE \
+	-DSPLIT_POINTING_ENABLE \
+	-DPOINTING_DEVICE_RIGHT \
+	-DSPLIT_TRANSPORT_DELTA \
+	-DSPLIT_TRANSPORT_DELTA_EVENTS=8
+split_transactions_delta_INC := $(split_transactions_INC) $(QUANTUM_PATH)/pointing_device
+split_transactions_delta_SRC := $(split_transactions_SRC)
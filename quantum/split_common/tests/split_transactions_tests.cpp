@@ -0,0 +1,697 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "matrix.h"
+#include "serial_loopback.h"
+#include "transport.h"
+
+bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+
+static uint8_t master_leds;
+static uint8_t master_mods;
+static uint8_t slave_leds;
+static uint8_t slave_mods;
+
+bool is_keyboard_master(void) {
+    return !serial_loopback_is_slave();
+}
+
+bool is_transport_connected(void) {
+    return true;
+}
+
+uint8_t host_keyboard_leds(void) {
+    return master_leds;
+}
+
+void set_split_host_keyboard_leds(uint8_t led_state) {
+    slave_leds = led_state;
+}
+
+uint8_t get_mods(void) {
+    return master_mods;
+}
+
+void set_mods(uint8_t mods) {
+    slave_mods = mods;
+}
+
+uint8_t get_weak_mods(void) {
+    return 0;
+}
+
+void set_weak_mods(uint8_t mods) {}
+
+#ifdef SPLIT_POINTING_ENABLE
+#    include "pointing_device.h"
+
+// What the slave's sensor reports next, and all of what reached the master
+static report_mouse_t sensor_report;
+static int32_t        shared_x, shared_y, shared_v, shared_h;
+static uint8_t        shared_buttons;
+
+bool is_keyboard_left(void) {
+    return !serial_loopback_is_slave();
+}
+
+static report_mouse_t sensor_get_report(report_mouse_t mouse_report) {
+    mouse_report          = sensor_report;
+    sensor_report         = report_mouse_t{};
+    sensor_report.buttons = mouse_report.buttons;
+    return mouse_report;
+}
+
+extern const pointing_device_driver_t pointing_device_driver;
+const pointing_device_driver_t        pointing_device_driver = {NULL, sensor_get_report, NULL, NULL};
+
+void pointing_device_set_shared_report(report_mouse_t report) {
+    shared_buttons = report.buttons;
+    shared_x += report.x;
+    shared_y += report.y;
+    shared_v += report.v;
+    shared_h += report.h;
+}
+
+uint16_t pointing_device_get_shared_cpi(void) {
+    return 0;
+}
+#endif
+
+#ifdef SPLIT_TRANSPORT_STATS
+#    include "transport.h"
+#endif
+
+#ifdef SPLIT_STREAM_ENABLE
+// For the IDs of the streams, whose header checks their number the C way
+#    define _Static_assert static_assert
+#    include "transactions.h"
+#    undef _Static_assert
+#    include "crc.h"
+#endif
+}
+
+#define HALF_ROWS (MATRIX_ROWS / 2)
+// Matches FORCED_SYNC_THROTTLE_MS
+#define FORCED_SYNC_MS 100
+
+#ifdef SPLIT_TRANSPORT_BATCH
+#    define BATCHED 1
+#else
+#    define BATCHED 0
+#endif
+#ifdef SPLIT_TRANSPORT_PUSH
+#    define PUSHED 1
+#else
+#    define PUSHED 0
+#endif
+#ifdef SPLIT_TRANSPORT_DELTA
+#    define DELTA 1
+#else
+#    define DELTA 0
+#endif
+// The checksums read on every scan
+#ifdef SPLIT_POINTING_ENABLE
+#    define POLLS 2
+#else
+#    define POLLS 1
+#endif
+
+/* Time a scan spends on the link, an estimate for comparing configurations, not a measurement.
+ * The ChibiOS serial driver at its default 230400 baud sends 10 bits a byte, and the slave turns around
+ * twice a transaction, taken to be 10us each. I2C at 400kHz clocks 9 bits a byte, and a transaction adds
+ * a start, the address, a repeated start with the address again for the read, and a stop.
+ */
+typedef struct {
+    const char *name;
+    uint32_t    byte_ns;
+    uint32_t    transaction_ns;
+} link_model_t;
+
+static const link_model_t link_models[] = {
+    {"serial", 43403, 2 * 10000},
+    {"i2c", 22500, 2 * 22500 + 3 * 2500},
+};
+
+#define LINK_MODELS (sizeof(link_models) / sizeof(link_models[0]))
+
+static uint32_t link_us(const link_model_t *link, uint32_t transactions, uint32_t bytes) {
+    return ((uint64_t)bytes * link->byte_ns + (uint64_t)transactions * link->transaction_ns) / 1000;
+}
+
+static matrix_row_t master_matrix[HALF_ROWS];
+static matrix_row_t slave_view[HALF_ROWS];
+static matrix_row_t slave_keys[HALF_ROWS];
+static matrix_row_t slave_mirror[HALF_ROWS];
+static bool         master_okay;
+
+static void slave_scan(void) {
+    transactions_slave(slave_mirror, slave_keys);
+}
+
+class SplitTransactions : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        serial_loopback_reset();
+        std::memset(master_matrix, 0, sizeof(master_matrix));
+        std::memset(slave_view, 0, sizeof(slave_view));
+        std::memset(slave_keys, 0, sizeof(slave_keys));
+        master_leds = master_mods = slave_leds = slave_mods = 0;
+#ifdef SPLIT_POINTING_ENABLE
+        sensor_report  = report_mouse_t{};
+        shared_buttons = shared_x = shared_y = shared_v = shared_h = 0;
+#endif
+
+        // Leave the forced syncs of earlier tests behind
+        set_time(1000);
+        scan();
+        advance_time(FORCED_SYNC_MS);
+        scan();
+    }
+
+    // A matrix scan on both halves, returning the transactions it took
+    static uint32_t scan(void) {
+        uint32_t before = serial_loopback_get_stats()->transactions;
+        serial_loopback_slave(slave_scan);
+        master_okay = transactions_master(master_matrix, slave_view);
+        advance_time(1);
+        return serial_loopback_get_stats()->transactions - before;
+    }
+};
+
+TEST_F(SplitTransactions, SlaveKeysReachMaster) {
+    slave_keys[1] = 0x05;
+    scan();
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(slave_view[1], 0x05);
+
+    slave_keys[1] = 0;
+    slave_keys[HALF_ROWS - 1] = 0x20;
+    scan();
+    EXPECT_EQ(slave_view[1], 0);
+    EXPECT_EQ(slave_view[HALF_ROWS - 1], 0x20);
+}
+
+TEST_F(SplitTransactions, StateReachesSlave) {
+    master_leds = 0x02;
+    master_mods = 0x11;
+    scan();
+    EXPECT_TRUE(master_okay);
+    // Applied by the slave on its next scan
+    scan();
+    EXPECT_EQ(slave_leds, 0x02);
+    EXPECT_EQ(slave_mods, 0x11);
+}
+
+TEST_F(SplitTransactions, IdleScans) {
+    uint32_t total = 0;
+    for (int i = 0; i < FORCED_SYNC_MS / 2; i++) {
+        uint32_t transactions = scan();
+        EXPECT_LE(transactions, POLLS);
+        total += transactions;
+    }
+#ifdef SPLIT_TRANSPORT_PUSH
+    // Only the polls bounding the staleness
+    EXPECT_LE(total, POLLS * (FORCED_SYNC_MS / 2 / SPLIT_PUSH_MAX_STALENESS_MS + 1));
+#else
+    EXPECT_EQ(total, POLLS * FORCED_SYNC_MS / 2);
+#endif
+}
+
+#ifdef SPLIT_TRANSPORT_PUSH
+TEST_F(SplitTransactions, PushedChangeIsReadAtOnce) {
+    for (int i = 0; i < SPLIT_PUSH_MAX_STALENESS_MS / 2; i++) {
+        scan();
+    }
+    slave_keys[0] = 0x10;
+    EXPECT_EQ(scan(), POLLS + 1);
+    EXPECT_EQ(slave_view[0], 0x10);
+
+    // Nothing left to ask for
+    EXPECT_EQ(scan(), 0);
+}
+
+TEST_F(SplitTransactions, LostAttentionIsBoundedByStaleness) {
+    serial_loopback_lose_attention();
+    slave_keys[3] = 0x01;
+
+    int scans = 0;
+    while (slave_view[3] != 0x01 && scans <= SPLIT_PUSH_MAX_STALENESS_MS) {
+        scan();
+        scans++;
+    }
+    EXPECT_EQ(slave_view[3], 0x01);
+    EXPECT_LE(scans, SPLIT_PUSH_MAX_STALENESS_MS);
+}
+#endif
+
+#ifdef SPLIT_TRANSPORT_DELTA
+TEST_F(SplitTransactions, DeltaCarriesOnlyTheChange) {
+    uint32_t bytes = serial_loopback_get_stats()->bytes;
+    slave_keys[HALF_ROWS - 1] = 0x0100;
+    EXPECT_EQ(scan(), POLLS + 1);
+    EXPECT_EQ(slave_view[HALF_ROWS - 1], 0x0100);
+    // The checksum, then less than reading the whole half would take
+    EXPECT_LT(serial_loopback_get_stats()->bytes - bytes, 3 + 2 + sizeof(slave_keys));
+}
+
+TEST_F(SplitTransactions, SequenceGapResyncs) {
+    // More changes than the slave keeps before the master gets to see them
+    for (int i = 0; i < SPLIT_TRANSPORT_DELTA_EVENTS + 3; i++) {
+        slave_keys[i % HALF_ROWS] ^= 1 << (i % MATRIX_COLS);
+        serial_loopback_slave(slave_scan);
+    }
+    scan();
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(std::memcmp(slave_view, slave_keys, sizeof(slave_keys)), 0);
+
+    // And from there on, changes come as deltas again
+    uint32_t bytes = serial_loopback_get_stats()->bytes;
+    slave_keys[0] ^= 0x02;
+    scan();
+    EXPECT_EQ(std::memcmp(slave_view, slave_keys, sizeof(slave_keys)), 0);
+    EXPECT_LT(serial_loopback_get_stats()->bytes - bytes, 3 + 2 + sizeof(slave_keys));
+}
+
+TEST_F(SplitTransactions, ChangesBetweenScansAreAllApplied) {
+    slave_keys[2] = 0x11;
+    serial_loopback_slave(slave_scan);
+    slave_keys[2] = 0x01;
+    slave_keys[5] = 0x80;
+    scan();
+    EXPECT_EQ(slave_view[2], 0x01);
+    EXPECT_EQ(slave_view[5], 0x80);
+}
+#endif
+
+#ifdef SPLIT_POINTING_ENABLE
+TEST_F(SplitTransactions, PointerMotionAddsUp) {
+    // Several sensor reports before the master reads any of them
+    for (int i = 0; i < 5; i++) {
+        sensor_report.x = 3;
+        sensor_report.y = -2;
+        serial_loopback_slave(slave_scan);
+        advance_time(1);
+    }
+    sensor_report.buttons = 0x01;
+    scan();
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(shared_x, 15);
+    EXPECT_EQ(shared_y, -10);
+    EXPECT_EQ(shared_buttons, 0x01);
+
+    // Nothing is sent twice
+    scan();
+    EXPECT_EQ(shared_x, 15);
+}
+
+TEST_F(SplitTransactions, PointerMotionOutgrowsAByte) {
+    for (int i = 0; i < 3; i++) {
+        sensor_report.v = 100;
+        serial_loopback_slave(slave_scan);
+        advance_time(1);
+    }
+    sensor_report.x = 100;
+    sensor_report.h = -1;
+    scan();
+    // The wheel total doesn't fit its report, the rest is clamped
+    EXPECT_EQ(shared_v, 127);
+    EXPECT_EQ(shared_x, 100);
+    EXPECT_EQ(shared_h, -1);
+}
+
+TEST_F(SplitTransactions, PointerMotionSurvivesALostReply) {
+    sensor_report.x = 7;
+    // The matrix and pointing checksums go through, the motion that follows them doesn't
+    serial_loopback_lose_reply(2);
+    scan();
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(serial_loopback_get_stats()->failures, 1);
+    EXPECT_EQ(shared_x, 7);
+
+    sensor_report.x = 1;
+    scan();
+    EXPECT_EQ(shared_x, 8);
+}
+
+TEST_F(SplitTransactions, TrackballWorkload) {
+    const serial_loopback_stats_t *stats  = serial_loopback_get_stats();
+    uint32_t                       before = stats->transactions;
+    uint32_t                       bytes  = stats->bytes;
+    const int                      scans  = 1000;
+    int                            moved  = 0;
+
+    // A 1kHz sensor moving all along, with a slower master taking every other scan
+    for (int i = 0; i < scans; i++) {
+        sensor_report.x = 1 + i % 3;
+        sensor_report.y = -1;
+        moved += sensor_report.x;
+        if (i % 2 == 0) {
+            serial_loopback_slave(slave_scan);
+            advance_time(1);
+        } else {
+            scan();
+            ASSERT_TRUE(master_okay);
+        }
+    }
+    scan();
+    EXPECT_EQ(shared_x, moved);
+    EXPECT_EQ(shared_y, -scans);
+    std::printf("split: trackball, %u scans in %u transactions and %u bytes\n", scans / 2, stats->transactions - before, stats->bytes - bytes);
+}
+#endif
+
+TEST_F(SplitTransactions, ChangesShareOneTransaction) {
+    slave_keys[0] = 0x01;
+    master_leds   = 0x04;
+    master_mods   = 0x02;
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXPECT_EQ(scan(), 1);
+#else
+    // Matrix checksum and data, then LEDs and mods
+    EXPECT_EQ(scan(), POLLS + 3);
+#endif
+    EXPECT_EQ(slave_view[0], 0x01);
+    scan();
+    EXPECT_EQ(slave_leds, 0x04);
+    EXPECT_EQ(slave_mods, 0x02);
+}
+
+#ifdef SPLIT_TRANSPORT_BATCH
+TEST_F(SplitTransactions, WritesSurviveAFailedFrame) {
+    // Enough writes to go out as a frame
+    master_leds = 0x04;
+    master_mods = 0x02;
+    // More failures in a row than the frame is retried
+    serial_loopback_drop(10);
+    scan();
+    scan();
+    EXPECT_EQ(slave_leds, 0x04);
+    EXPECT_EQ(slave_mods, 0x02);
+}
+#endif
+
+TEST_F(SplitTransactions, CorruptedReplyIsRetried) {
+    slave_keys[2] = 0x03;
+    serial_loopback_corrupt_next();
+    EXPECT_GT(scan(), 1);
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(slave_view[2], 0x03);
+}
+
+TEST_F(SplitTransactions, DroppedTransactionIsRetried) {
+    slave_keys[1] = 0x08;
+    serial_loopback_drop(1);
+    scan();
+    EXPECT_TRUE(master_okay);
+    EXPECT_EQ(slave_view[1], 0x08);
+    EXPECT_EQ(serial_loopback_get_stats()->failures, 1);
+}
+
+#ifdef SPLIT_TRANSPORT_STATS
+TEST_F(SplitTransactions, LinkStatisticsAddUp) {
+    const serial_loopback_stats_t *link = serial_loopback_get_stats();
+    split_transaction_stats_reset();
+    uint32_t before = link->transactions;
+    uint32_t bytes  = link->bytes;
+
+    slave_keys[1] = 0x08;
+    serial_loopback_drop(2);
+    scan();
+    master_leds = 0x01;
+    scan();
+    EXPECT_TRUE(master_okay);
+
+    split_transaction_stats_t        total = {};
+    const split_transaction_stats_t *stats;
+    for (int8_t id = 0; (stats = split_transaction_stats_get(id)) != NULL; id++) {
+        total.attempts += stats->attempts;
+        total.failures += stats->failures;
+        total.retries += stats->retries;
+        total.bytes += stats->bytes;
+        EXPECT_LE(stats->rtt_min, stats->rtt_max);
+    }
+    EXPECT_EQ(total.attempts, link->transactions - before + 2);
+    EXPECT_EQ(total.failures, 2);
+    EXPECT_EQ(total.retries, 2);
+    // Less the ID and handshake of each transaction
+    EXPECT_EQ(total.bytes, link->bytes - bytes - 2 * (link->transactions - before));
+    EXPECT_NE(split_transaction_stats_last_failed(), -1);
+
+    split_transaction_stats_reset();
+    EXPECT_EQ(split_transaction_stats_get(0)->attempts, 0);
+    EXPECT_EQ(split_transaction_stats_last_failed(), -1);
+}
+#endif
+
+#ifdef SPLIT_STREAM_ENABLE
+// The slave's stream buffers and what the keymaps were handed
+static uint8_t  slave_stream[1024];
+static uint8_t  slave_snapshot[300];
+static uint16_t slave_received;
+static int      slave_handed;
+static bool     stream_done;
+static bool     stream_success;
+static uint16_t stream_length;
+
+static char     slave_handed_text[8];
+
+static void slave_stream_received(int8_t transaction_id, const void *data, uint16_t length) {
+    slave_received = length;
+    slave_handed++;
+    std::memcpy(slave_handed_text, data, sizeof(slave_handed_text));
+}
+
+static void stream_callback(int8_t transaction_id, bool success, uint16_t length, void *cb_arg) {
+    stream_done    = true;
+    stream_success = success;
+    stream_length  = length;
+}
+
+class SplitStreams : public SplitTransactions {
+   protected:
+    void SetUp() override {
+        SplitTransactions::SetUp();
+        // The transfers run from a deferred executor table, which needs time to move forward
+        static uint32_t now = 10000;
+        set_time(now += 10000);
+        scan();
+        advance_time(FORCED_SYNC_MS);
+        scan();
+
+        std::memset(slave_stream, 0, sizeof(slave_stream));
+        for (size_t i = 0; i < sizeof(slave_snapshot); i++) {
+            slave_snapshot[i] = i * 7;
+        }
+        slave_received = 0;
+        slave_handed   = 0;
+        stream_done    = false;
+        transaction_register_stream(USER_STREAM, slave_stream, sizeof(slave_stream), slave_stream_received);
+        transaction_register_stream(USER_SNAPSHOT, slave_snapshot, sizeof(slave_snapshot), NULL);
+    }
+
+    // Scans until the transfer is over, returning the most transactions a scan took
+    static uint32_t scan_until_done(int limit) {
+        uint32_t most = 0;
+        for (int i = 0; i < limit && !stream_done; i++) {
+            most = std::max(most, scan());
+        }
+        return most;
+    }
+};
+
+static uint8_t stream_data[1000];
+
+static void fill_stream_data(void) {
+    for (size_t i = 0; i < sizeof(stream_data); i++) {
+        stream_data[i] = i ^ (i >> 8);
+    }
+}
+
+TEST_F(SplitStreams, SendArrivesWhole) {
+    fill_stream_data();
+    ASSERT_NE(transaction_stream_send(USER_STREAM, stream_data, sizeof(stream_data), stream_callback, NULL), INVALID_DEFERRED_TOKEN);
+    // A fragment per scan, on top of the usual transactions
+    EXPECT_LE(scan_until_done(1000), POLLS + 1);
+    EXPECT_TRUE(stream_done);
+    EXPECT_TRUE(stream_success);
+    EXPECT_EQ(stream_length, sizeof(stream_data));
+    scan();
+    EXPECT_EQ(slave_handed, 1);
+    EXPECT_EQ(slave_received, sizeof(stream_data));
+    EXPECT_EQ(std::memcmp(slave_stream, stream_data, sizeof(stream_data)), 0);
+}
+
+TEST_F(SplitStreams, RecvReadsSlaveBuffer) {
+    static uint8_t buffer[512];
+    std::memset(buffer, 0, sizeof(buffer));
+    ASSERT_NE(transaction_stream_recv(USER_SNAPSHOT, buffer, sizeof(buffer), stream_callback, NULL), INVALID_DEFERRED_TOKEN);
+    scan_until_done(100);
+    EXPECT_TRUE(stream_success);
+    EXPECT_EQ(stream_length, sizeof(slave_snapshot));
+    EXPECT_EQ(std::memcmp(buffer, slave_snapshot, sizeof(slave_snapshot)), 0);
+}
+
+TEST_F(SplitStreams, LostFragmentsAreSentAgain) {
+    fill_stream_data();
+    transaction_stream_send(USER_STREAM, stream_data, sizeof(stream_data), stream_callback, NULL);
+    for (int i = 0; i < 5; i++) {
+        scan();
+    }
+    serial_loopback_lose_reply(POLLS);
+    scan();
+    serial_loopback_drop(POLLS + 1);
+    scan();
+    scan();
+    serial_loopback_corrupt_next();
+    scan_until_done(1000);
+    EXPECT_TRUE(stream_success);
+    scan();
+    EXPECT_EQ(slave_handed, 1);
+    EXPECT_EQ(slave_received, sizeof(stream_data));
+    EXPECT_EQ(std::memcmp(slave_stream, stream_data, sizeof(stream_data)), 0);
+}
+
+TEST_F(SplitStreams, BusySlaveHoldsOff) {
+    static const uint8_t first[] = "first";
+    static const uint8_t second[] = "second";
+    transaction_stream_send(USER_STREAM, first, sizeof(first), stream_callback, NULL);
+    scan_until_done(10);
+    EXPECT_TRUE(stream_success);
+
+    // Without the slave's main loop running, the first write isn't handed over
+    stream_done = false;
+    transaction_stream_send(USER_STREAM, second, sizeof(second), stream_callback, NULL);
+    for (int i = 0; i < 20; i++) {
+        transactions_master(master_matrix, slave_view);
+        advance_time(1);
+    }
+    EXPECT_FALSE(stream_done);
+    EXPECT_EQ(slave_handed, 0);
+
+    scan_until_done(10);
+    EXPECT_TRUE(stream_success);
+    EXPECT_EQ(slave_handed, 1);
+    EXPECT_STREQ(slave_handed_text, "first");
+    scan();
+    EXPECT_EQ(slave_handed, 2);
+    EXPECT_STREQ(slave_handed_text, "second");
+}
+
+// Sends a fragment to the slave's stream, as a master would
+static uint8_t send_fragment(uint8_t sequence, uint8_t flags, const char *text) {
+    split_stream_request_t request = {};
+    request.transaction_id         = USER_STREAM;
+    request.sequence               = sequence;
+    request.flags                  = flags;
+    request.count                  = text ? std::strlen(text) + 1 : 0;
+    if (text) {
+        std::memcpy(request.data, text, request.count);
+    }
+    request.length   = offsetof(split_stream_request_t, data) - 1 + request.count;
+    request.checksum = crc8(&request.offset, request.length - 1);
+
+    split_stream_reply_t reply;
+    EXPECT_TRUE(transport_execute_transaction(EXCHANGE_STREAM, &request, 1 + request.length, &reply, sizeof(reply)));
+    return reply.status;
+}
+
+// Writes a whole transfer as a single fragment
+static uint8_t send_text(uint8_t sequence, const char *text) {
+    return send_fragment(sequence, SPLIT_STREAM_WRITE | SPLIT_STREAM_START | SPLIT_STREAM_END, text);
+}
+
+TEST_F(SplitStreams, RetransmissionIsWrittenOnce) {
+    EXPECT_EQ(send_text(0x40, "one"), SPLIT_STREAM_OK);
+    EXPECT_EQ(send_text(0x40, "one"), SPLIT_STREAM_OK);
+    scan();
+    scan();
+    EXPECT_EQ(slave_handed, 1);
+    EXPECT_STREQ(slave_handed_text, "one");
+}
+
+TEST_F(SplitStreams, RestartedMasterIsNotTakenForARetransmission) {
+    EXPECT_EQ(send_text(0x40, "one"), SPLIT_STREAM_OK);
+    scan();
+    // The same data under the same sequence number, which the old master happened to be at
+    EXPECT_EQ(send_fragment(0x40, SPLIT_STREAM_SYNC, NULL), SPLIT_STREAM_OK);
+    EXPECT_EQ(send_fragment(0x40, SPLIT_STREAM_SYNC, NULL), SPLIT_STREAM_OK);
+    EXPECT_EQ(send_text(0x40, "one"), SPLIT_STREAM_OK);
+    scan();
+    EXPECT_EQ(slave_handed, 2);
+    EXPECT_STREQ(slave_handed_text, "one");
+}
+
+TEST_F(SplitStreams, OversizedSendFails) {
+    static uint8_t data[sizeof(slave_snapshot) + 1];
+    transaction_stream_send(USER_SNAPSHOT, data, sizeof(data), stream_callback, NULL);
+    scan_until_done(100);
+    EXPECT_TRUE(stream_done);
+    EXPECT_FALSE(stream_success);
+}
+
+TEST_F(SplitStreams, OneTransferPerStream) {
+    fill_stream_data();
+    deferred_token token = transaction_stream_send(USER_STREAM, stream_data, sizeof(stream_data), stream_callback, NULL);
+    EXPECT_EQ(transaction_stream_send(USER_STREAM, stream_data, sizeof(stream_data), stream_callback, NULL), INVALID_DEFERRED_TOKEN);
+    EXPECT_TRUE(transaction_stream_cancel(token));
+    EXPECT_FALSE(transaction_stream_cancel(token));
+    scan();
+    EXPECT_FALSE(stream_done);
+}
+#endif
+
+TEST_F(SplitTransactions, TypingWorkload) {
+    const serial_loopback_stats_t *stats   = serial_loopback_get_stats();
+    uint32_t                       before  = stats->transactions;
+    uint32_t                       bytes   = stats->bytes;
+    uint32_t                       longest[LINK_MODELS] = {};
+    const int                      scans   = 1000;
+
+    for (int i = 0; i < scans; i++) {
+        uint32_t scan_transactions = stats->transactions;
+        uint32_t scan_bytes        = stats->bytes;
+        // A key on either half every 20ms, with the modifiers following along
+        if (i % 20 == 0) {
+            slave_keys[(i / 20) % HALF_ROWS] ^= 1 << ((i / 40) % MATRIX_COLS);
+        }
+        if (i % 50 == 0) {
+            master_mods ^= 0x02;
+        }
+        if (i % 250 == 0) {
+            master_leds ^= 0x01;
+        }
+        scan();
+        ASSERT_TRUE(master_okay);
+        ASSERT_EQ(std::memcmp(slave_view, slave_keys, sizeof(slave_keys)), 0) << "scan " << i;
+        for (size_t link = 0; link < LINK_MODELS; link++) {
+            longest[link] = std::max(longest[link], link_us(&link_models[link], stats->transactions - scan_transactions, stats->bytes - scan_bytes));
+        }
+    }
+
+    uint32_t transactions = stats->transactions - before;
+    bytes                 = stats->bytes - bytes;
+#if defined(SPLIT_TRANSPORT_PUSH)
+    // Only scans with something to send or fetch use the link
+    EXPECT_LT(transactions, scans / 2);
+#elif defined(SPLIT_TRANSPORT_BATCH)
+    // The writes share the reads' transaction, so only reading the changed keys and the forced matrix refresh take a second one,
+    // along with a lone write, the sync timer or the modifiers changing, that doesn't make up for a frame
+    EXPECT_LE(transactions, scans + scans / 20 + scans / FORCED_SYNC_MS + (SPLIT_TRANSPORT_BATCH_MIN_WRITES > 1 ? scans / FORCED_SYNC_MS + scans / 50 : 0) + 1);
+#else
+    EXPECT_GT(transactions, scans);
+#endif
+    std::printf("split: %s%s%s, %u scans in %u transactions and %u bytes\n", BATCHED ? "batched" : "unbatched", PUSHED ? ", push" : "", DELTA ? ", delta" : "", scans, transactions, bytes);
+    for (size_t link = 0; link < LINK_MODELS; link++) {
+        std::printf("split: over %s, link time %uus a scan on average and %uus at most\n", link_models[link].name, link_us(&link_models[link], transactions, bytes) / scans, longest[link]);
+    }
+}
@@ -0,0 +1 @@
+TEST_LIST += split_transactions split_transactions_batch split_transactions_push split_transactions_batch_push split_transactions_stats split_transactions_stream split_transactions_delta
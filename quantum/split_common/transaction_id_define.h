@@ -23,6 +23,9 @@ enum serial_transaction_id {
 
     GET_SLAVE_MATRIX_CHECKSUM,
     GET_SLAVE_MATRIX_DATA,
+#ifdef SPLIT_TRANSPORT_DELTA
+    GET_SLAVE_MATRIX_DELTA,
+#endif // SPLIT_TRANSPORT_DELTA
 
 #ifdef SPLIT_TRANSPORT_MIRROR
     PUT_MASTER_MATRIX,
@@ -82,6 +85,9 @@ enum serial_transaction_id {
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
     GET_POINTING_CHECKSUM,
     GET_POINTING_DATA,
+#    ifdef SPLIT_TRANSPORT_DELTA
+    GET_POINTING_DELTA,
+#    endif // SPLIT_TRANSPORT_DELTA
     PUT_POINTING_CPI,
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -97,11 +103,18 @@ enum serial_transaction_id {
     PUT_ACTIVITY,
 #endif // SPLIT_ACTIVITY_ENABLE
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    EXCHANGE_BATCH,
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     PUT_RPC_INFO,
     PUT_RPC_REQ_DATA,
     EXECUTE_RPC,
     GET_RPC_RESP_DATA,
+#    ifdef SPLIT_STREAM_ENABLE
+    EXCHANGE_STREAM,
+#    endif // SPLIT_STREAM_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 // keyboard-specific
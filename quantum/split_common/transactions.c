@@ -30,6 +30,7 @@
 #include "transaction_id_define.h"
 #include "split_util.h"
 #include "synchronization_util.h"
+#include "util.h"
 
 #ifdef BACKLIGHT_ENABLE
 #    include "backlight.h"
@@ -84,9 +85,15 @@
 #define trans_initiator2target_cb(cb) \
     { 0, 0, 0, 0, cb }
 
-#define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
-#define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
-#define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#ifdef SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) batch_execute_transaction(id, data, length, NULL, 0)
+#    define transport_read(id, data, length) batch_execute_transaction(id, NULL, 0, data, length)
+#    define transport_exec(id) batch_execute_transaction(id, NULL, 0, NULL, 0)
+#else // SPLIT_TRANSPORT_BATCH
+#    define transport_write(id, data, length) transport_execute_transaction(id, data, length, NULL, 0)
+#    define transport_read(id, data, length) transport_execute_transaction(id, NULL, 0, data, length)
+#    define transport_exec(id) transport_execute_transaction(id, NULL, 0, NULL, 0)
+#endif // SPLIT_TRANSPORT_BATCH
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 // Forward-declare the RPC callback handlers
@@ -94,6 +101,431 @@ void slave_rpc_info_callback(uint8_t initiator2target_buffer_size, const void *i
 void slave_rpc_exec_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+////////////////////////////////////////////////////
+// Push mode
+
+#ifdef SPLIT_TRANSPORT_PUSH
+
+#    ifndef SPLIT_PUSH_MAX_STALENESS_MS
+#        define SPLIT_PUSH_MAX_STALENESS_MS 10
+#    endif // SPLIT_PUSH_MAX_STALENESS_MS
+
+#    define PUSH_SLAVE_MATRIX (1 << 0)
+#    define PUSH_ENCODERS (1 << 1)
+#    define PUSH_POINTING (1 << 2)
+
+// Slave: checksums changed since the master last read them
+static uint8_t push_pending = 0;
+// Master: whether the slave's data is read this scan
+static bool push_fetch = true;
+
+static void push_begin(void) {
+    static uint32_t last_fetch = 0;
+    push_fetch                 = transport_slave_attention() || timer_elapsed32(last_fetch) >= SPLIT_PUSH_MAX_STALENESS_MS;
+    if (push_fetch) {
+        last_fetch = timer_read32();
+    }
+}
+
+#    define push_mark_changed(old_checksum, new_checksum, bit) \
+        do {                                                   \
+            if ((old_checksum) != (new_checksum)) {            \
+                push_pending |= (bit);                         \
+            }                                                  \
+        } while (0)
+
+static void push_slave_matrix_fetched(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    push_pending &= ~PUSH_SLAVE_MATRIX;
+}
+
+#    ifdef ENCODER_ENABLE
+static void push_encoders_fetched(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    push_pending &= ~PUSH_ENCODERS;
+}
+#    endif // ENCODER_ENABLE
+
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+static void push_pointing_fetched(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    push_pending &= ~PUSH_POINTING;
+}
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+
+// Reading a checksum is what clears the slave's request for attention
+#    define trans_pushed_initializer(member, name) trans_target2initiator_initializer_cb(member, push_##name##_fetched)
+
+#    define TRANSACTIONS_PUSH_MASTER() push_begin()
+#    define TRANSACTIONS_PUSH_SLAVE() transport_slave_signal(push_pending != 0)
+
+#else // SPLIT_TRANSPORT_PUSH
+
+#    define push_mark_changed(old_checksum, new_checksum, bit)
+#    define trans_pushed_initializer(member, name) trans_target2initiator_initializer(member)
+
+#    define TRANSACTIONS_PUSH_MASTER()
+#    define TRANSACTIONS_PUSH_SLAVE()
+
+#endif // SPLIT_TRANSPORT_PUSH
+
+////////////////////////////////////////////////////
+// Batched frames
+
+#ifdef SPLIT_TRANSPORT_BATCH
+
+#    if defined(__AVR__) && !defined(USE_I2C)
+#        error "SPLIT_TRANSPORT_BATCH is not supported by the AVR serial driver, which runs the slave callback before receiving"
+#    endif
+
+/* The master's frame is a length byte, the CRC of its copy of the data of each of the reads below, a
+ * bitmap of the writes it carries, their payloads in transaction ID order, and a CRC8 of everything
+ * after the length byte. Only transactions with a fixed size buffer written by the master go into a
+ * frame, each with a bit in the bitmap, so they need no header of their own: both halves know the size
+ * of the payload. Writes shorter than the buffer are sent on their own.
+ *
+ * The slave's reply is a length byte and a section of [index][checksum][data] for each read the master's
+ * copy is stale for. Reads the master is up to date on are left out, their checksum being the CRC the
+ * master sent. A read whose data doesn't fit has only its checksum, which makes the master read it
+ * separately. The reply doesn't need a CRC, as the data read is checked against its checksum.
+ */
+typedef struct {
+    int8_t checksum_id;
+    int8_t data_id;
+} batch_read_t;
+
+static const batch_read_t batch_reads[] = {
+    {GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA},
+#    ifdef ENCODER_ENABLE
+    {GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA},
+#    endif // ENCODER_ENABLE
+#    if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+    {GET_POINTING_CHECKSUM, GET_POINTING_DATA},
+#    endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
+};
+
+#    define BATCH_HEADER_SIZE ARRAY_SIZE(batch_reads)
+#    define BATCH_MAP_MAX_SIZE ((NUM_TOTAL_TRANSACTIONS + 7) / 8)
+// Marks a reply section carrying only the checksum of a read
+#    define BATCH_CHECKSUM_ONLY 0x80
+// A reply of a single section with this index makes the master retry the frame
+#    define BATCH_REJECTED 0x7F
+
+_Static_assert(SPLIT_TRANSPORT_BATCH_SIZE > 2 + BATCH_HEADER_SIZE + BATCH_MAP_MAX_SIZE && SPLIT_TRANSPORT_BATCH_SIZE > 1 + 2 * BATCH_HEADER_SIZE, "SPLIT_TRANSPORT_BATCH_SIZE too small for the frame header");
+
+static bool    batch_collecting = false;
+static uint8_t batch_writes;
+static uint8_t batch_request[SPLIT_TRANSPORT_BATCH_SIZE];
+static uint8_t batch_reply[SPLIT_TRANSPORT_BATCH_SIZE];
+// The answers to each read from the last exchange, cleared once taken
+static bool    batch_checksum_ready[BATCH_HEADER_SIZE];
+static uint8_t batch_checksum[BATCH_HEADER_SIZE];
+// Where the data of each read is in batch_reply, zero if not answered or already taken
+static uint8_t batch_data_offset[BATCH_HEADER_SIZE];
+
+static bool batch_writable(int8_t id) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    return trans->initiator2target_buffer_size > 0 && trans->target2initiator_buffer_size == 0 && !(trans->flags & SPLIT_TRANSACTION_LENGTH_PREFIXED);
+}
+
+// Bytes of the bitmap, one bit for each transaction that can be written in a frame
+static uint8_t batch_map_size(void) {
+    uint8_t count = 0;
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        count += batch_writable(id);
+    }
+    return (count + 7) / 8;
+}
+
+#    define batch_map(frame) (&(frame)[1 + BATCH_HEADER_SIZE])
+#    define batch_carries(map, index) (((map)[(index) / 8] >> ((index) % 8)) & 1)
+
+/* Calls `visit` with the ID and payload of every write a frame carries, in order, stopping if it returns
+ * false. Returns where the payloads end, or zero if they would go past `end` or a bit is set past the
+ * last transaction.
+ */
+static uint16_t batch_walk_writes(uint8_t *frame, uint16_t end, bool (*visit)(int8_t id, uint8_t *payload, uint8_t length)) {
+    const uint8_t *map    = batch_map(frame);
+    uint8_t        index  = 0;
+    uint16_t       offset = 1 + BATCH_HEADER_SIZE + batch_map_size();
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        if (!batch_writable(id)) {
+            continue;
+        }
+        if (batch_carries(map, index)) {
+            uint8_t length = split_transaction_table[id].initiator2target_buffer_size;
+            if (offset + length > end) {
+                return 0;
+            }
+            if (visit && !visit(id, &frame[offset], length)) {
+                return 0;
+            }
+            offset += length;
+        }
+        index++;
+    }
+    return index % 8 != 0 && (map[index / 8] >> (index % 8)) != 0 ? 0 : offset;
+}
+
+static uint8_t batch_reply_length(uint8_t tag) {
+    uint8_t index = tag & ~BATCH_CHECKSUM_ONLY;
+    if (index >= BATCH_HEADER_SIZE) {
+        return 0;
+    }
+    return 1 + ((tag & BATCH_CHECKSUM_ONLY) ? 0 : split_transaction_table[batch_reads[index].data_id].target2initiator_buffer_size);
+}
+
+// Checks that the sections of a reply end exactly where it does
+static bool batch_reply_valid(const uint8_t *reply) {
+    uint16_t end    = 1 + reply[0];
+    uint16_t offset = 1;
+    if (end > SPLIT_TRANSPORT_BATCH_SIZE) {
+        return false;
+    }
+    while (offset < end) {
+        uint8_t length = batch_reply_length(reply[offset]);
+        if (length == 0) {
+            return false;
+        }
+        offset += 1 + length;
+    }
+    return offset == end;
+}
+
+// Returns where the section goes after its tag, or NULL if it doesn't fit with `reserve` bytes left over
+static uint8_t *batch_reply_add(uint8_t *reply, uint8_t tag, uint8_t length, uint8_t reserve) {
+    uint16_t end = 1 + reply[0];
+    if (end + 1 + length + reserve > SPLIT_TRANSPORT_BATCH_SIZE) {
+        return NULL;
+    }
+    reply[end] = tag;
+    reply[0] += 1 + length;
+    return &reply[end + 1];
+}
+
+static void batch_begin(void) {
+    batch_request[0] = BATCH_HEADER_SIZE + batch_map_size();
+    memset(batch_map(batch_request), 0, batch_map_size());
+    batch_writes     = 0;
+    batch_collecting = true;
+}
+
+static bool batch_fill_payload(int8_t id, uint8_t *payload, uint8_t length) {
+    memcpy(payload, split_trans_initiator2target_buffer(&split_transaction_table[id]), length);
+    return true;
+}
+
+static uint8_t batch_replayed;
+
+static void batch_end(void) {
+    batch_collecting = false;
+    batch_replayed   = 0;
+    if (batch_writes == 0) {
+        return;
+    }
+
+    for (uint8_t i = 0; i < BATCH_HEADER_SIZE; i++) {
+        split_transaction_desc_t *trans = &split_transaction_table[batch_reads[i].data_id];
+        batch_request[1 + i]            = crc8(split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+    }
+    // The payloads are the local copies, which the writes kept in line with what they sent
+    batch_walk_writes(batch_request, SPLIT_TRANSPORT_BATCH_SIZE - 1, batch_fill_payload);
+    batch_request[1 + batch_request[0]] = crc8(&batch_request[1], batch_request[0]);
+    batch_request[0]++;
+}
+
+// Hands out an answer from the last exchange the same way the transport would, through the shared memory
+static bool batch_take(int8_t id, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    for (uint8_t i = 0; i < BATCH_HEADER_SIZE; i++) {
+        if (id == batch_reads[i].checksum_id && batch_checksum_ready[i]) {
+            *split_trans_target2initiator_buffer(trans) = batch_checksum[i];
+            *(uint8_t *)target2initiator_buf            = batch_checksum[i];
+            batch_checksum_ready[i]                     = false;
+            return true;
+        }
+        if (id == batch_reads[i].data_id && batch_data_offset[i]) {
+            memcpy(split_trans_target2initiator_buffer(trans), &batch_reply[batch_data_offset[i]], trans->target2initiator_buffer_size);
+            memcpy(target2initiator_buf, &batch_reply[batch_data_offset[i]], MIN(trans->target2initiator_buffer_size, target2initiator_length));
+            batch_data_offset[i] = 0;
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool batch_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    if (batch_collecting && initiator2target_length > 0 && target2initiator_length == 0 && initiator2target_length == trans->initiator2target_buffer_size && batch_writable(id)) {
+        uint8_t *map   = batch_map(batch_request);
+        uint8_t  index = 0;
+        for (int8_t i = 0; i < id; i++) {
+            index += batch_writable(i);
+        }
+        // Leaving room for the CRC
+        if (batch_carries(map, index) || 1 + batch_request[0] + initiator2target_length + 1 <= SPLIT_TRANSPORT_BATCH_SIZE) {
+            if (!batch_carries(map, index)) {
+                map[index / 8] |= 1 << (index % 8);
+                batch_request[0] += initiator2target_length;
+                batch_writes++;
+            }
+            // Keep the local copy in line with what is sent, as the transport does, it is the payload of the frame
+            memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, initiator2target_length);
+            return true;
+        }
+    }
+    if (initiator2target_length == 0 && target2initiator_length > 0 && batch_take(id, target2initiator_buf, target2initiator_length)) {
+        return true;
+    }
+    return transport_execute_transaction(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+}
+
+static uint8_t batch_replay_count;
+
+// Sends a write of the frame on its own, skipping those an earlier attempt already delivered
+static bool batch_replay_write(int8_t id, uint8_t *payload, uint8_t length) {
+    if (batch_replay_count++ < batch_replayed) {
+        return true;
+    }
+    if (!transport_execute_transaction(id, payload, length, NULL, 0)) {
+        return false;
+    }
+    batch_replayed++;
+    return true;
+}
+
+// Sends the writes of a frame that didn't get through, or doesn't pay off, as separate transactions
+static bool batch_replay_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    batch_replay_count = 0;
+    return batch_writes == 0 || batch_walk_writes(batch_request, batch_request[0], batch_replay_write) != 0;
+}
+
+static bool batch_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    for (uint8_t i = 0; i < BATCH_HEADER_SIZE; i++) {
+        batch_checksum_ready[i] = false;
+        batch_data_offset[i]    = 0;
+    }
+
+    // Too few writes to make up for the frame's overhead, so they and the reads go out on their own
+    if (batch_writes < SPLIT_TRANSPORT_BATCH_MIN_WRITES) {
+        return batch_replay_handlers_master(master_matrix, slave_matrix);
+    }
+#    ifdef SPLIT_TRANSPORT_PUSH
+    // The answers come for free with the writes
+    push_fetch = true;
+#    endif // SPLIT_TRANSPORT_PUSH
+
+    if (!transport_execute_transaction(EXCHANGE_BATCH, batch_request, 1 + batch_request[0], batch_reply, sizeof(batch_reply))) {
+        return false;
+    }
+    if (!batch_reply_valid(batch_reply)) {
+        return false;
+    }
+
+    for (uint8_t i = 0; i < BATCH_HEADER_SIZE; i++) {
+        batch_checksum[i]       = batch_request[1 + i];
+        batch_checksum_ready[i] = true;
+    }
+    for (uint16_t offset = 1; offset < 1 + batch_reply[0]; offset += 1 + batch_reply_length(batch_reply[offset])) {
+        uint8_t index         = batch_reply[offset] & ~BATCH_CHECKSUM_ONLY;
+        batch_checksum[index] = batch_reply[offset + 1];
+        if (!(batch_reply[offset] & BATCH_CHECKSUM_ONLY)) {
+            batch_data_offset[index] = offset + 2;
+        }
+    }
+    return true;
+}
+
+static bool batch_apply_write(int8_t id, uint8_t *payload, uint8_t length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+    memcpy(split_trans_initiator2target_buffer(trans), payload, length);
+    if (trans->slave_callback) {
+        trans->slave_callback(length, split_trans_initiator2target_buffer(trans), 0, NULL);
+    }
+    return true;
+}
+
+static void batch_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    uint8_t *request = split_shmem->batch.m2s;
+    uint8_t *reply   = split_shmem->batch.s2m;
+
+    uint16_t end = request[0];
+    if (end < 1 + BATCH_HEADER_SIZE + batch_map_size() || 1 + end > SPLIT_TRANSPORT_BATCH_SIZE || crc8(&request[1], end - 1) != request[end] || batch_walk_writes(request, end, NULL) != end) {
+        reply[0] = 1;
+        reply[1] = BATCH_REJECTED;
+        return;
+    }
+    batch_walk_writes(request, end, batch_apply_write);
+
+    reply[0] = 0;
+    for (uint8_t i = 0; i < BATCH_HEADER_SIZE; i++) {
+        split_transaction_desc_t *checksum_trans = &split_transaction_table[batch_reads[i].checksum_id];
+        split_transaction_desc_t *data_trans     = &split_transaction_table[batch_reads[i].data_id];
+        if (checksum_trans->slave_callback) {
+            checksum_trans->slave_callback(0, NULL, checksum_trans->target2initiator_buffer_size, split_trans_target2initiator_buffer(checksum_trans));
+        }
+        uint8_t checksum = *split_trans_target2initiator_buffer(checksum_trans);
+        if (checksum == request[1 + i]) {
+            continue;
+        }
+        // Room is kept for the checksums of the reads after this one
+        uint8_t  reserve = 2 * (BATCH_HEADER_SIZE - 1 - i);
+        uint8_t *payload = batch_reply_add(reply, i, 1 + data_trans->target2initiator_buffer_size, reserve);
+        if (payload) {
+            memcpy(&payload[1], split_trans_target2initiator_buffer(data_trans), data_trans->target2initiator_buffer_size);
+        } else {
+            payload = batch_reply_add(reply, i | BATCH_CHECKSUM_ONLY, 1, reserve);
+        }
+        payload[0] = checksum;
+    }
+}
+
+// The writes were handed to the frame as if sent, so they are delivered on their own if it fails
+#    define TRANSACTIONS_BATCH_MASTER()                                                                      \
+        do {                                                                                                 \
+            if (!transaction_handler_master(master_matrix, slave_matrix, "batch", &batch_handlers_master)) { \
+                TRANSACTION_HANDLER_MASTER(batch_replay);                                                    \
+            }                                                                                                \
+        } while (0)
+
+// clang-format off
+#    define TRANSACTIONS_BATCH_REGISTRATIONS \
+    [EXCHANGE_BATCH] = { sizeof_member(split_shared_memory_t, batch.m2s), offsetof(split_shared_memory_t, batch.m2s), sizeof_member(split_shared_memory_t, batch.s2m), offsetof(split_shared_memory_t, batch.s2m), batch_handlers_slave_exchange, SPLIT_TRANSACTION_LENGTH_PREFIXED },
+// clang-format on
+
+#else // SPLIT_TRANSPORT_BATCH
+
+#    define TRANSACTIONS_BATCH_REGISTRATIONS
+
+#endif // SPLIT_TRANSPORT_BATCH
+
+////////////////////////////////////////////////////
+// Delta encoding
+
+#ifdef SPLIT_TRANSPORT_DELTA
+
+#    if defined(__AVR__) && !defined(USE_I2C)
+#        error "SPLIT_TRANSPORT_DELTA is not supported by the AVR serial driver, which runs the slave callback before receiving"
+#    endif
+#    ifdef SPLIT_TRANSPORT_BATCH
+#        error "SPLIT_TRANSPORT_DELTA and SPLIT_TRANSPORT_BATCH cannot be used together, the batched frame already carries the slave's data"
+#    endif
+
+/* The slave answers a request carrying the sequence number of the last change the master has, with
+ * the changes since then. Both buffers are length prefixed, so only what changed is transferred.
+ */
+#    define trans_delta_initializer(member, cb) \
+        { sizeof_member(split_shared_memory_t, member.request), offsetof(split_shared_memory_t, member.request), sizeof_member(split_shared_memory_t, member.reply), offsetof(split_shared_memory_t, member.reply), cb, SPLIT_TRANSACTION_LENGTH_PREFIXED }
+#    define trans_delta_registration(id, member, cb) [id] = trans_delta_initializer(member, cb),
+
+static bool delta_execute_transaction(int8_t id, uint8_t since, void *reply, uint16_t length) {
+    split_delta_request_t request = {.length = sizeof(request) - 1, .since = since};
+    return transport_execute_transaction(id, &request, sizeof(request), reply, length);
+}
+
+#else // SPLIT_TRANSPORT_DELTA
+
+#    define trans_delta_registration(id, member, cb)
+
+#endif // SPLIT_TRANSPORT_DELTA
+
 ////////////////////////////////////////////////////
 // Helpers
 
@@ -109,7 +541,11 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
         this_okay      = handler(master_matrix, slave_matrix);
         if (this_okay) return true;
     }
+#ifdef SPLIT_TRANSPORT_STATS
+    dprintf("Failed to execute %s, last failed transaction: %d\n", prefix, split_transaction_stats_last_failed());
+#else
     dprintf("Failed to execute %s\n", prefix);
+#endif // SPLIT_TRANSPORT_STATS
     return false;
 }
 
@@ -145,6 +581,12 @@ static bool transaction_handler_master(matrix_row_t master_matrix[], matrix_row_
     } while (0)
 
 inline static bool read_if_checksum_mismatch(int8_t trans_id_checksum, int8_t trans_id_retrieve, uint32_t *last_update, void *destination, const void *equiv_shmem, size_t length) {
+#ifdef SPLIT_TRANSPORT_PUSH
+    if (!push_fetch) {
+        memcpy(destination, equiv_shmem, length);
+        return true;
+    }
+#endif // SPLIT_TRANSPORT_PUSH
     uint8_t curr_checksum;
     bool    okay = transport_read(trans_id_checksum, &curr_checksum, sizeof(curr_checksum));
     if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(equiv_shmem, length))) {
@@ -178,12 +620,111 @@ inline static bool send_if_data_mismatch(int8_t trans_id, uint32_t *last_update,
 ////////////////////////////////////////////////////
 // Slave matrix
 
+#ifdef SPLIT_TRANSPORT_DELTA
+
+// Slave: the last changes to its half, slave_matrix_sequence numbering the latest
+static split_delta_event_t slave_matrix_events[SPLIT_TRANSPORT_DELTA_EVENTS];
+static uint8_t             slave_matrix_sequence = 0;
+// Master: the sequence number of the last change in its copy
+static uint8_t slave_matrix_applied = 0;
+
+static void slave_matrix_record(const matrix_row_t old_matrix[], const matrix_row_t new_matrix[]) {
+    for (uint8_t row = 0; row < (MATRIX_ROWS) / 2; row++) {
+        matrix_row_t changed = old_matrix[row] ^ new_matrix[row];
+        for (uint8_t col = 0; changed; col++, changed >>= 1) {
+            if (changed & 1) {
+                split_delta_event_t event = row * (MATRIX_COLS) + col;
+                if (new_matrix[row] & (MATRIX_ROW_SHIFTER << col)) {
+                    event |= SPLIT_DELTA_EVENT_PRESSED;
+                }
+                slave_matrix_sequence++;
+                slave_matrix_events[slave_matrix_sequence % SPLIT_TRANSPORT_DELTA_EVENTS] = event;
+            }
+        }
+    }
+}
+
+static void slave_matrix_delta_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_slave_matrix_delta_reply_t *reply   = &split_shmem->smatrix_delta.reply;
+    uint8_t                           since   = split_shmem->smatrix_delta.request.since;
+    uint8_t                           missing = slave_matrix_sequence - since;
+
+    // Too far behind, the master reads the whole matrix instead
+    if (missing > SPLIT_TRANSPORT_DELTA_EVENTS) {
+        missing = 0;
+    }
+    for (uint8_t i = 0; i < missing; i++) {
+        reply->events[i] = slave_matrix_events[(uint8_t)(since + 1 + i) % SPLIT_TRANSPORT_DELTA_EVENTS];
+    }
+    reply->sequence = slave_matrix_sequence;
+    reply->checksum = split_shmem->smatrix.checksum;
+    reply->length   = offsetof(split_slave_matrix_delta_reply_t, events) - 1 + missing * sizeof(split_delta_event_t);
+}
+
+static void slave_matrix_apply(matrix_row_t matrix[], const split_slave_matrix_delta_reply_t *reply) {
+    uint8_t count = (reply->length + 1 - offsetof(split_slave_matrix_delta_reply_t, events)) / sizeof(split_delta_event_t);
+    if (count != (uint8_t)(reply->sequence - slave_matrix_applied)) {
+        return;
+    }
+    for (uint8_t i = 0; i < count; i++) {
+        split_delta_event_t position = reply->events[i] & ~SPLIT_DELTA_EVENT_PRESSED;
+        uint8_t             row      = position / (MATRIX_COLS);
+        uint8_t             col      = position % (MATRIX_COLS);
+        if (row >= (MATRIX_ROWS) / 2) {
+            return;
+        }
+        if (reply->events[i] & SPLIT_DELTA_EVENT_PRESSED) {
+            matrix[row] |= MATRIX_ROW_SHIFTER << col;
+        } else {
+            matrix[row] &= ~(MATRIX_ROW_SHIFTER << col);
+        }
+    }
+}
+
+// Brings the master's copy of the slave matrix up to date with the changes since the last one it has
+static bool read_delta_if_checksum_mismatch(uint32_t *last_update, matrix_row_t destination[]) {
+    matrix_row_t *matrix = split_shmem->smatrix.matrix;
+    const size_t  length = sizeof(split_shmem->smatrix.matrix);
+#    ifdef SPLIT_TRANSPORT_PUSH
+    if (!push_fetch) {
+        memcpy(destination, matrix, length);
+        return true;
+    }
+#    endif // SPLIT_TRANSPORT_PUSH
+    uint8_t curr_checksum;
+    bool    okay = transport_read(GET_SLAVE_MATRIX_CHECKSUM, &curr_checksum, sizeof(curr_checksum));
+    // The forced sync only has to confirm there is nothing missing, which is as cheap as an idle delta
+    if (okay && (timer_elapsed32(*last_update) >= FORCED_SYNC_THROTTLE_MS || curr_checksum != crc8(matrix, length))) {
+        split_slave_matrix_delta_reply_t reply;
+        okay = delta_execute_transaction(GET_SLAVE_MATRIX_DELTA, slave_matrix_applied, &reply, sizeof(reply)) && reply.length + 1 >= offsetof(split_slave_matrix_delta_reply_t, events);
+        if (okay) {
+            slave_matrix_apply(matrix, &reply);
+            slave_matrix_applied = reply.sequence;
+            // A gap in the sequence, or a copy gone astray: resync from the whole matrix
+            if (crc8(matrix, length) != reply.checksum) {
+                okay = transport_read(GET_SLAVE_MATRIX_DATA, destination, length) && crc8(matrix, length) == reply.checksum;
+            }
+        }
+        if (okay) {
+            *last_update = timer_read32();
+        }
+    }
+    memcpy(destination, matrix, length);
+    return okay;
+}
+
+#endif // SPLIT_TRANSPORT_DELTA
+
 static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
     static uint32_t     last_update                    = 0;
     static matrix_row_t last_matrix[(MATRIX_ROWS) / 2] = {0}; // last successfully-read matrix, so we can replicate if there are checksum errors
     matrix_row_t        temp_matrix[(MATRIX_ROWS) / 2];       // holding area while we test whether or not checksum is correct
 
+#ifdef SPLIT_TRANSPORT_DELTA
+    bool okay = read_delta_if_checksum_mismatch(&last_update, temp_matrix);
+#else  // SPLIT_TRANSPORT_DELTA
     bool okay = read_if_checksum_mismatch(GET_SLAVE_MATRIX_CHECKSUM, GET_SLAVE_MATRIX_DATA, &last_update, temp_matrix, split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+#endif // SPLIT_TRANSPORT_DELTA
     if (okay) {
         // Checksum matches the received data, save as the last matrix state
         memcpy(last_matrix, temp_matrix, sizeof(temp_matrix));
@@ -194,16 +735,22 @@ static bool slave_matrix_handlers_master(matrix_row_t master_matrix[], matrix_ro
 }
 
 static void slave_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+#ifdef SPLIT_TRANSPORT_DELTA
+    slave_matrix_record(split_shmem->smatrix.matrix, slave_matrix);
+#endif // SPLIT_TRANSPORT_DELTA
     memcpy(split_shmem->smatrix.matrix, slave_matrix, sizeof(split_shmem->smatrix.matrix));
-    split_shmem->smatrix.checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    uint8_t checksum = crc8(split_shmem->smatrix.matrix, sizeof(split_shmem->smatrix.matrix));
+    push_mark_changed(split_shmem->smatrix.checksum, checksum, PUSH_SLAVE_MATRIX);
+    split_shmem->smatrix.checksum = checksum;
 }
 
 // clang-format off
 #define TRANSACTIONS_SLAVE_MATRIX_MASTER() TRANSACTION_HANDLER_MASTER(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(slave_matrix)
 #define TRANSACTIONS_SLAVE_MATRIX_REGISTRATIONS \
-    [GET_SLAVE_MATRIX_CHECKSUM] = trans_target2initiator_initializer(smatrix.checksum), \
-    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix),
+    [GET_SLAVE_MATRIX_CHECKSUM] = trans_pushed_initializer(smatrix.checksum, slave_matrix), \
+    [GET_SLAVE_MATRIX_DATA]     = trans_target2initiator_initializer(smatrix.matrix), \
+    trans_delta_registration(GET_SLAVE_MATRIX_DELTA, smatrix_delta, slave_matrix_delta_callback)
 // clang-format on
 
 ////////////////////////////////////////////////////
@@ -267,7 +814,9 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
     // Always prepare the encoder state for read.
     encoder_retrieve_events(&split_shmem->encoders.events);
     // Now update the checksum given that the encoders has been written to
-    split_shmem->encoders.checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+    uint8_t checksum = crc8(&split_shmem->encoders.events, sizeof(split_shmem->encoders.events));
+    push_mark_changed(split_shmem->encoders.checksum, checksum, PUSH_ENCODERS);
+    split_shmem->encoders.checksum = checksum;
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
@@ -278,7 +827,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_MASTER() TRANSACTION_HANDLER_MASTER(encoder)
 #    define TRANSACTIONS_ENCODERS_SLAVE() TRANSACTION_HANDLER_SLAVE_AUTOLOCK(encoder)
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
-    [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
+    [GET_ENCODERS_CHECKSUM] = trans_pushed_initializer(encoders.checksum, encoders), \
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
     [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
 // clang-format on
@@ -705,6 +1254,138 @@ static void st7565_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sla
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
+#    ifdef SPLIT_TRANSPORT_DELTA
+
+/* Instead of the latest report, the slave sends the motion added up since the master last asked, kept
+ * until the next request acknowledges it by carrying the sequence number of the reply. Nothing is lost
+ * to a failed transaction or to the master reading less often than the sensor reports, and a reply
+ * only has the axes that moved, a byte each unless one of them doesn't fit.
+ *
+ * The checksum transaction counts the reports that changed something instead, for the master to tell
+ * when there is anything to fetch.
+ */
+#        define POINTING_DELTA_AXES 4
+#        define POINTING_DELTA_WIDE (1 << POINTING_DELTA_AXES)
+
+// Slave: the motion, as x, y, v and h, not sent yet and sent but not acknowledged
+static int16_t pointing_unsent[POINTING_DELTA_AXES];
+static int16_t pointing_unacked[POINTING_DELTA_AXES];
+static uint8_t pointing_buttons  = 0;
+static uint8_t pointing_sequence = 0;
+// Master: the sequence number of the last reply received
+static uint8_t pointing_received = 0;
+
+static int16_t pointing_delta_add(int16_t total, int16_t motion) {
+    int32_t sum = (int32_t)total + motion;
+    return sum < INT16_MIN ? INT16_MIN : sum > INT16_MAX ? INT16_MAX : sum;
+}
+
+static int16_t pointing_delta_clamp(int16_t motion, int16_t min, int16_t max) {
+    return motion < min ? min : motion > max ? max : motion;
+}
+
+static void pointing_delta_record(const report_mouse_t *report) {
+    const int16_t motion[POINTING_DELTA_AXES] = {report->x, report->y, report->v, report->h};
+    bool          changed                     = report->buttons != pointing_buttons;
+    for (uint8_t i = 0; i < POINTING_DELTA_AXES; i++) {
+        if (motion[i] != 0) {
+            pointing_unsent[i] = pointing_delta_add(pointing_unsent[i], motion[i]);
+            changed            = true;
+        }
+    }
+    pointing_buttons = report->buttons;
+    if (changed) {
+        uint8_t counter = split_shmem->pointing.checksum + 1;
+        push_mark_changed(split_shmem->pointing.checksum, counter, PUSH_POINTING);
+        split_shmem->pointing.checksum = counter;
+    }
+}
+
+static void pointing_delta_callback(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    split_slave_pointing_delta_reply_t *reply = &split_shmem->pointing_delta.reply;
+
+    // Unless the master got the last reply, its motion goes again
+    bool resend = split_shmem->pointing_delta.request.since != pointing_sequence;
+    bool wide   = false;
+    for (uint8_t i = 0; i < POINTING_DELTA_AXES; i++) {
+        if (resend) {
+            pointing_unsent[i] = pointing_delta_add(pointing_unsent[i], pointing_unacked[i]);
+        }
+        pointing_unacked[i] = pointing_unsent[i];
+        pointing_unsent[i]  = 0;
+        wide |= pointing_unacked[i] < INT8_MIN || pointing_unacked[i] > INT8_MAX;
+    }
+
+    uint8_t length = 0;
+    reply->axes    = wide ? POINTING_DELTA_WIDE : 0;
+    for (uint8_t i = 0; i < POINTING_DELTA_AXES; i++) {
+        if (pointing_unacked[i] != 0) {
+            reply->axes |= 1 << i;
+            reply->values[length++] = pointing_unacked[i] & 0xFF;
+            if (wide) {
+                reply->values[length++] = pointing_unacked[i] >> 8;
+            }
+        }
+    }
+    reply->sequence = ++pointing_sequence;
+    reply->buttons  = pointing_buttons;
+    reply->length   = offsetof(split_slave_pointing_delta_reply_t, values) - 1 + length;
+}
+
+static bool pointing_delta_decode(const split_slave_pointing_delta_reply_t *reply, report_mouse_t *report) {
+    int16_t motion[POINTING_DELTA_AXES] = {0};
+    uint8_t offset                      = 0;
+    uint8_t step                        = (reply->axes & POINTING_DELTA_WIDE) ? 2 : 1;
+    if (reply->length + 1 < offsetof(split_slave_pointing_delta_reply_t, values)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < POINTING_DELTA_AXES; i++) {
+        if (reply->axes & (1 << i)) {
+            if (offsetof(split_slave_pointing_delta_reply_t, values) + offset + step > reply->length + 1) {
+                return false;
+            }
+            motion[i] = step == 2 ? (int16_t)(reply->values[offset] | reply->values[offset + 1] << 8) : (int8_t)reply->values[offset];
+            offset += step;
+        }
+    }
+    report->buttons = reply->buttons;
+    report->x       = pointing_delta_clamp(motion[0], XY_REPORT_MIN, XY_REPORT_MAX);
+    report->y       = pointing_delta_clamp(motion[1], XY_REPORT_MIN, XY_REPORT_MAX);
+    report->v       = pointing_delta_clamp(motion[2], INT8_MIN, INT8_MAX);
+    report->h       = pointing_delta_clamp(motion[3], INT8_MIN, INT8_MAX);
+    return true;
+}
+
+static bool pointing_read_delta(uint32_t *last_update) {
+#        ifdef SPLIT_TRANSPORT_PUSH
+    // Anything that moved stays with the slave until it is fetched
+    if (!push_fetch) {
+        return true;
+    }
+#        endif // SPLIT_TRANSPORT_PUSH
+    static uint8_t last_counter = 0;
+    uint8_t        counter;
+    if (!transport_read(GET_POINTING_CHECKSUM, &counter, sizeof(counter))) {
+        return false;
+    }
+    if (counter == last_counter && timer_elapsed32(*last_update) < FORCED_SYNC_THROTTLE_MS) {
+        return true;
+    }
+
+    split_slave_pointing_delta_reply_t reply;
+    report_mouse_t                     report = {0};
+    if (!delta_execute_transaction(GET_POINTING_DELTA, pointing_received, &reply, sizeof(reply)) || !pointing_delta_decode(&reply, &report)) {
+        return false;
+    }
+    pointing_received = reply.sequence;
+    last_counter      = counter;
+    *last_update      = timer_read32();
+    pointing_device_set_shared_report(report);
+    return true;
+}
+
+#    endif // SPLIT_TRANSPORT_DELTA
+
 static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
 #    if defined(POINTING_DEVICE_LEFT)
     if (is_keyboard_left()) {
@@ -718,10 +1399,14 @@ static bool pointing_handlers_master(matrix_row_t master_matrix[], matrix_row_t
     static uint32_t last_update     = 0;
     static uint32_t last_cpi_update = 0;
     static uint16_t last_cpi        = 0;
-    report_mouse_t  temp_state;
     uint16_t        temp_cpi;
-    bool            okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
+#    ifdef SPLIT_TRANSPORT_DELTA
+    bool okay = pointing_read_delta(&last_update);
+#    else  // SPLIT_TRANSPORT_DELTA
+    report_mouse_t temp_state;
+    bool           okay = read_if_checksum_mismatch(GET_POINTING_CHECKSUM, GET_POINTING_DATA, &last_update, &temp_state, &split_shmem->pointing.report, sizeof(temp_state));
     if (okay) pointing_device_set_shared_report(temp_state);
+#    endif // SPLIT_TRANSPORT_DELTA
     temp_cpi = pointing_device_get_shared_cpi();
     if (temp_cpi) {
         split_shmem->pointing.cpi = temp_cpi;
@@ -764,18 +1449,27 @@ static void pointing_handlers_slave(matrix_row_t master_matrix[], matrix_row_t s
         pointing_device_driver.set_cpi(pointing.cpi);
     }
 
+#    ifdef SPLIT_TRANSPORT_DELTA
+    report_mouse_t report = pointing_device_driver.get_report((report_mouse_t){0});
+
+    split_shared_memory_lock();
+    pointing_delta_record(&report);
+    split_shared_memory_unlock();
+#    else  // SPLIT_TRANSPORT_DELTA
     pointing.report = pointing_device_driver.get_report((report_mouse_t){0});
     // Now update the checksum given that the pointing has been written to
     pointing.checksum = crc8(&pointing.report, sizeof(report_mouse_t));
 
     split_shared_memory_lock();
+    push_mark_changed(split_shmem->pointing.checksum, pointing.checksum, PUSH_POINTING);
     memcpy(&split_shmem->pointing, &pointing, sizeof(split_slave_pointing_sync_t));
     split_shared_memory_unlock();
+#    endif // SPLIT_TRANSPORT_DELTA
 }
 
 #    define TRANSACTIONS_POINTING_MASTER() TRANSACTION_HANDLER_MASTER(pointing)
 #    define TRANSACTIONS_POINTING_SLAVE() TRANSACTION_HANDLER_SLAVE(pointing)
-#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_target2initiator_initializer(pointing.checksum), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi),
+#    define TRANSACTIONS_POINTING_REGISTRATIONS [GET_POINTING_CHECKSUM] = trans_pushed_initializer(pointing.checksum, pointing), [GET_POINTING_DATA] = trans_target2initiator_initializer(pointing.report), [PUT_POINTING_CPI] = trans_initiator2target_initializer(pointing.cpi), trans_delta_registration(GET_POINTING_DELTA, pointing_delta, pointing_delta_callback)
 
 #else // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
@@ -914,6 +1608,339 @@ static void detected_os_handlers_slave(matrix_row_t master_matrix[], matrix_row_
 
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 
+////////////////////////////////////////////////////
+// Streams
+
+#if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+// The last of the core transactions, those of the keyboard and the keymap follow it
+#    ifdef SPLIT_STREAM_ENABLE
+#        define LAST_CORE_TRANSACTION EXCHANGE_STREAM
+#    else
+#        define LAST_CORE_TRANSACTION GET_RPC_RESP_DATA
+#    endif // SPLIT_STREAM_ENABLE
+#endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
+
+#ifdef SPLIT_STREAM_ENABLE
+
+#    if !defined(SPLIT_TRANSACTION_IDS_KB) && !defined(SPLIT_TRANSACTION_IDS_USER)
+#        error "SPLIT_STREAM_ENABLE needs the IDs of the streams in SPLIT_TRANSACTION_IDS_KB or SPLIT_TRANSACTION_IDS_USER"
+#    endif
+#    ifndef DEFERRED_EXEC_ENABLE
+#        error "SPLIT_STREAM_ENABLE needs DEFERRED_EXEC_ENABLE = yes"
+#    endif
+#    if defined(__AVR__) && !defined(USE_I2C)
+#        error "SPLIT_STREAM_ENABLE is not supported by the AVR serial driver, which runs the slave callback before receiving"
+#    endif
+
+#    ifndef SPLIT_STREAM_CONCURRENT_TRANSFERS
+#        define SPLIT_STREAM_CONCURRENT_TRANSFERS 2
+#    endif // SPLIT_STREAM_CONCURRENT_TRANSFERS
+
+#    ifndef SPLIT_STREAM_BURST
+#        define SPLIT_STREAM_BURST 1
+#    endif // SPLIT_STREAM_BURST
+
+#    ifndef SPLIT_STREAM_MAX_RETRIES
+#        define SPLIT_STREAM_MAX_RETRIES 10
+#    endif // SPLIT_STREAM_MAX_RETRIES
+
+#    define STREAM_FIRST_ID (LAST_CORE_TRANSACTION + 1)
+#    define STREAM_COUNT (NUM_TOTAL_TRANSACTIONS - STREAM_FIRST_ID)
+// What follows the length byte ahead of the data
+#    define STREAM_REQUEST_HEADER (offsetof(split_stream_request_t, data) - 1)
+#    define STREAM_REPLY_HEADER (offsetof(split_stream_reply_t, data) - 1)
+
+/* A transfer moves one fragment per transaction and waits for the slave to acknowledge it. A
+ * fragment whose reply went missing is sent again under the same sequence number, which the slave
+ * acknowledges without applying it twice. The first write to a stream after the master boots is
+ * preceded by a sync, making the slave forget the last sequence number it saw, as the master's
+ * numbering starts over. Until the keymap on the slave has been handed the last write to a stream,
+ * further writes to it are answered busy, holding the master off. Every transfer is a deferred
+ * executor, sending up to SPLIT_STREAM_BURST fragments each millisecond from the master's scan, so
+ * large transfers are spread over many scans instead of stalling one of them. That caps a transfer
+ * at SPLIT_STREAM_BURST * SPLIT_STREAM_FRAGMENT_SIZE bytes per millisecond, 32 KB/s by default,
+ * which is about what a 400 kHz I2C or a 460800 baud serial link can move along with the scan.
+ */
+typedef struct {
+    uint8_t                *buffer;
+    uint16_t                length;
+    uint16_t                offset;
+    int8_t                  transaction_id;
+    bool                    write;
+    // The sequence number of the fragment in flight, once it has been sent
+    bool                    sequenced;
+    uint8_t                 sequence;
+    uint8_t                 failures;
+    deferred_token          token;
+    split_stream_callback_t callback;
+    void                   *cb_arg;
+} stream_transfer_t;
+
+// One executor to spare, so a callback can start the next transfer before its own has ended
+static deferred_executor_t stream_executors[SPLIT_STREAM_CONCURRENT_TRANSFERS + 1];
+static stream_transfer_t   stream_transfers[SPLIT_STREAM_CONCURRENT_TRANSFERS];
+static uint8_t             stream_sequences[STREAM_COUNT];
+static bool                stream_synced[STREAM_COUNT];
+
+typedef struct {
+    uint8_t                *buffer;
+    uint16_t                size;
+    uint16_t                received;
+    split_stream_received_t callback;
+    // The sequence number of the last fragment written, to recognise it when it is sent again
+    bool    sequenced;
+    uint8_t sequence;
+    // Complete, waiting to be handed to the keymap from the slave's main loop
+    volatile bool pending;
+} stream_slave_t;
+
+static stream_slave_t stream_slaves[STREAM_COUNT];
+
+enum { STREAM_STEP_MORE, STREAM_STEP_WAIT, STREAM_STEP_DONE, STREAM_STEP_FAILED };
+
+static uint8_t stream_transfer_step(stream_transfer_t *transfer) {
+    uint8_t stream = transfer->transaction_id - STREAM_FIRST_ID;
+    if (!transfer->sequenced) {
+        transfer->sequence  = stream_sequences[stream]++;
+        transfer->sequenced = true;
+    }
+
+    // Writes nothing until the slave has acknowledged it, so it can be sent again as often as needed
+    bool                   sync    = transfer->write && !stream_synced[stream];
+    split_stream_request_t request = {
+        .offset         = transfer->offset,
+        .transaction_id = transfer->transaction_id,
+        .sequence       = transfer->sequence,
+        .flags          = sync ? SPLIT_STREAM_SYNC : transfer->write ? SPLIT_STREAM_WRITE : 0,
+        .count          = sync ? 0 : MIN(transfer->length - transfer->offset, SPLIT_STREAM_FRAGMENT_SIZE),
+    };
+    uint8_t data_length = 0;
+    if (transfer->write && !sync) {
+        data_length = request.count;
+        memcpy(request.data, &transfer->buffer[transfer->offset], data_length);
+        if (transfer->offset == 0) {
+            request.flags |= SPLIT_STREAM_START;
+        }
+        if (transfer->offset + data_length == transfer->length) {
+            request.flags |= SPLIT_STREAM_END;
+        }
+    }
+    request.length   = STREAM_REQUEST_HEADER + data_length;
+    request.checksum = crc8(&request.offset, request.length - 1);
+
+    split_stream_reply_t reply;
+    if (!transport_execute_transaction(EXCHANGE_STREAM, &request, 1 + request.length, &reply, sizeof(reply)) || reply.length < STREAM_REPLY_HEADER || crc8(&reply.size, reply.length - 1) != reply.checksum || reply.sequence != request.sequence || reply.status == SPLIT_STREAM_CORRUPT) {
+        return ++transfer->failures > SPLIT_STREAM_MAX_RETRIES ? STREAM_STEP_FAILED : STREAM_STEP_WAIT;
+    }
+    transfer->failures = 0;
+    if (reply.status == SPLIT_STREAM_BUSY) {
+        return STREAM_STEP_WAIT;
+    }
+    if (reply.status != SPLIT_STREAM_OK) {
+        return STREAM_STEP_FAILED;
+    }
+    transfer->sequenced = false;
+
+    if (sync) {
+        stream_synced[stream] = true;
+        return STREAM_STEP_MORE;
+    }
+    if (transfer->write) {
+        transfer->offset += data_length;
+        return transfer->offset == transfer->length ? STREAM_STEP_DONE : STREAM_STEP_MORE;
+    }
+
+    // Reads end with the slave's buffer
+    uint8_t count = MIN(reply.length - STREAM_REPLY_HEADER, request.count);
+    memcpy(&transfer->buffer[transfer->offset], reply.data, count);
+    transfer->offset += count;
+    transfer->length = MIN(transfer->length, reply.size);
+    return transfer->offset >= transfer->length || count == 0 ? STREAM_STEP_DONE : STREAM_STEP_MORE;
+}
+
+static uint32_t stream_transfer_callback(uint32_t trigger_time, void *cb_arg) {
+    stream_transfer_t *transfer = (stream_transfer_t *)cb_arg;
+    for (uint8_t i = 0; i < SPLIT_STREAM_BURST; i++) {
+        uint8_t step = stream_transfer_step(transfer);
+        if (step == STREAM_STEP_WAIT) {
+            break;
+        }
+        if (step != STREAM_STEP_MORE) {
+            // Free the transfer first, the callback may start another one
+            transfer->token = INVALID_DEFERRED_TOKEN;
+            if (transfer->callback) {
+                transfer->callback(transfer->transaction_id, step == STREAM_STEP_DONE, transfer->offset, transfer->cb_arg);
+            }
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static deferred_token stream_transfer_start(int8_t transaction_id, bool write, void *buffer, uint16_t length, split_stream_callback_t callback, void *cb_arg) {
+    if (transaction_id < STREAM_FIRST_ID || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    stream_transfer_t *transfer = NULL;
+    for (uint8_t i = 0; i < SPLIT_STREAM_CONCURRENT_TRANSFERS; i++) {
+        if (stream_transfers[i].token == INVALID_DEFERRED_TOKEN) {
+            if (!transfer) {
+                transfer = &stream_transfers[i];
+            }
+        } else if (stream_transfers[i].transaction_id == transaction_id) {
+            // One transfer per stream at a time
+            return INVALID_DEFERRED_TOKEN;
+        }
+    }
+    if (!transfer) {
+        return INVALID_DEFERRED_TOKEN;
+    }
+
+    transfer->buffer         = (uint8_t *)buffer;
+    transfer->length         = length;
+    transfer->offset         = 0;
+    transfer->transaction_id = transaction_id;
+    transfer->write          = write;
+    transfer->sequenced      = false;
+    transfer->failures       = 0;
+    transfer->callback       = callback;
+    transfer->cb_arg         = cb_arg;
+    transfer->token          = defer_exec_advanced(stream_executors, ARRAY_SIZE(stream_executors), 1, stream_transfer_callback, transfer);
+    return transfer->token;
+}
+
+deferred_token transaction_stream_send(int8_t transaction_id, const void *data, uint16_t length, split_stream_callback_t callback, void *cb_arg) {
+    return stream_transfer_start(transaction_id, true, (void *)data, length, callback, cb_arg);
+}
+
+deferred_token transaction_stream_recv(int8_t transaction_id, void *buffer, uint16_t size, split_stream_callback_t callback, void *cb_arg) {
+    return stream_transfer_start(transaction_id, false, buffer, size, callback, cb_arg);
+}
+
+bool transaction_stream_cancel(deferred_token token) {
+    for (uint8_t i = 0; i < SPLIT_STREAM_CONCURRENT_TRANSFERS; i++) {
+        if (token != INVALID_DEFERRED_TOKEN && stream_transfers[i].token == token) {
+            cancel_deferred_exec_advanced(stream_executors, ARRAY_SIZE(stream_executors), token);
+            stream_transfers[i].token = INVALID_DEFERRED_TOKEN;
+            return true;
+        }
+    }
+    return false;
+}
+
+void transaction_register_stream(int8_t transaction_id, void *buffer, uint16_t size, split_stream_received_t callback) {
+    if (transaction_id < STREAM_FIRST_ID || transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return;
+    }
+
+    stream_slave_t *stream = &stream_slaves[transaction_id - STREAM_FIRST_ID];
+    stream->buffer         = (uint8_t *)buffer;
+    stream->size           = size;
+    stream->received       = 0;
+    stream->callback       = callback;
+    stream->sequenced      = false;
+    stream->pending        = false;
+}
+
+static uint8_t stream_slave_handle(const split_stream_request_t *request, split_stream_reply_t *reply, uint8_t *count) {
+    if (request->length < STREAM_REQUEST_HEADER || crc8(&request->offset, request->length - 1) != request->checksum || request->count > SPLIT_STREAM_FRAGMENT_SIZE) {
+        return SPLIT_STREAM_CORRUPT;
+    }
+    if (request->transaction_id < STREAM_FIRST_ID || request->transaction_id >= NUM_TOTAL_TRANSACTIONS) {
+        return SPLIT_STREAM_REJECTED;
+    }
+    stream_slave_t *stream = &stream_slaves[request->transaction_id - STREAM_FIRST_ID];
+    if (!stream->buffer) {
+        return SPLIT_STREAM_REJECTED;
+    }
+    reply->size = stream->size;
+
+    if (request->flags & SPLIT_STREAM_SYNC) {
+        stream->sequenced = false;
+        return SPLIT_STREAM_OK;
+    }
+    if (!(request->flags & SPLIT_STREAM_WRITE)) {
+        if (request->offset > stream->size) {
+            return SPLIT_STREAM_REJECTED;
+        }
+        *count = MIN(request->count, stream->size - request->offset);
+        memcpy(reply->data, &stream->buffer[request->offset], *count);
+        return SPLIT_STREAM_OK;
+    }
+
+    if (request->length != STREAM_REQUEST_HEADER + request->count) {
+        return SPLIT_STREAM_CORRUPT;
+    }
+    // Sent again as the reply went missing, it has been written already
+    if (stream->sequenced && request->sequence == stream->sequence) {
+        return SPLIT_STREAM_OK;
+    }
+    if (request->flags & SPLIT_STREAM_START) {
+        if (stream->pending) {
+            return SPLIT_STREAM_BUSY;
+        }
+        stream->received = 0;
+    }
+    if (stream->pending || request->offset != stream->received || request->offset + request->count > stream->size) {
+        return SPLIT_STREAM_REJECTED;
+    }
+
+    memcpy(&stream->buffer[request->offset], request->data, request->count);
+    stream->received += request->count;
+    stream->sequence  = request->sequence;
+    stream->sequenced = true;
+    if (request->flags & SPLIT_STREAM_END) {
+        stream->pending = true;
+    }
+    return SPLIT_STREAM_OK;
+}
+
+static void stream_handlers_slave_exchange(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
+    const split_stream_request_t *request = (const split_stream_request_t *)initiator2target_buffer;
+    split_stream_reply_t         *reply   = (split_stream_reply_t *)target2initiator_buffer;
+    uint8_t                       count   = 0;
+
+    reply->size     = 0;
+    reply->sequence = request->sequence;
+    reply->status   = stream_slave_handle(request, reply, &count);
+    reply->length   = STREAM_REPLY_HEADER + count;
+    reply->checksum = crc8(&reply->size, reply->length - 1);
+}
+
+static bool stream_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    static uint32_t last_stream_exec = 0;
+    deferred_exec_advanced_task(stream_executors, ARRAY_SIZE(stream_executors), &last_stream_exec);
+    return true;
+}
+
+static void stream_handlers_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    for (uint8_t i = 0; i < STREAM_COUNT; i++) {
+        stream_slave_t *stream = &stream_slaves[i];
+        if (stream->pending) {
+            if (stream->callback) {
+                stream->callback(STREAM_FIRST_ID + i, stream->buffer, stream->received);
+            }
+            stream->pending = false;
+        }
+    }
+}
+
+// clang-format off
+#    define TRANSACTIONS_STREAM_MASTER() TRANSACTION_HANDLER_MASTER(stream)
+#    define TRANSACTIONS_STREAM_SLAVE() TRANSACTION_HANDLER_SLAVE(stream)
+#    define TRANSACTIONS_STREAM_REGISTRATIONS \
+        [EXCHANGE_STREAM] = { sizeof_member(split_shared_memory_t, stream.request), offsetof(split_shared_memory_t, stream.request), sizeof_member(split_shared_memory_t, stream.reply), offsetof(split_shared_memory_t, stream.reply), stream_handlers_slave_exchange, SPLIT_TRANSACTION_LENGTH_PREFIXED },
+// clang-format on
+
+#else // SPLIT_STREAM_ENABLE
+
+#    define TRANSACTIONS_STREAM_MASTER()
+#    define TRANSACTIONS_STREAM_SLAVE()
+#    define TRANSACTIONS_STREAM_REGISTRATIONS
+
+#endif // SPLIT_STREAM_ENABLE
+
 ////////////////////////////////////////////////////
 
 split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
@@ -944,6 +1971,8 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
     TRANSACTIONS_HAPTIC_REGISTRATIONS
     TRANSACTIONS_ACTIVITY_REGISTRATIONS
     TRANSACTIONS_DETECTED_OS_REGISTRATIONS
+    TRANSACTIONS_BATCH_REGISTRATIONS
+    TRANSACTIONS_STREAM_REGISTRATIONS
 // clang-format on
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
@@ -954,7 +1983,43 @@ split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS] = {
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 };
 
+#ifdef SPLIT_TRANSPORT_BATCH
+static bool batch_collect_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_MASTER_MATRIX_MASTER();
+    TRANSACTIONS_SYNC_TIMER_MASTER();
+    TRANSACTIONS_LAYER_STATE_MASTER();
+    TRANSACTIONS_LED_STATE_MASTER();
+    TRANSACTIONS_MODS_MASTER();
+    TRANSACTIONS_BACKLIGHT_MASTER();
+    TRANSACTIONS_RGBLIGHT_MASTER();
+    TRANSACTIONS_LED_MATRIX_MASTER();
+    TRANSACTIONS_RGB_MATRIX_MASTER();
+    TRANSACTIONS_WPM_MASTER();
+    TRANSACTIONS_OLED_MASTER();
+    TRANSACTIONS_ST7565_MASTER();
+    TRANSACTIONS_WATCHDOG_MASTER();
+    TRANSACTIONS_HAPTIC_MASTER();
+    TRANSACTIONS_ACTIVITY_MASTER();
+    TRANSACTIONS_DETECTED_OS_MASTER();
+    return true;
+}
+#endif // SPLIT_TRANSPORT_BATCH
+
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
+    TRANSACTIONS_PUSH_MASTER();
+#ifdef SPLIT_TRANSPORT_BATCH
+    // Collect the writes into the frame, exchange it, then answer the reads from the reply
+    batch_begin();
+    bool collected = batch_collect_master(master_matrix, slave_matrix);
+    batch_end();
+    if (!collected) return false;
+    TRANSACTIONS_BATCH_MASTER();
+    TRANSACTIONS_SLAVE_MATRIX_MASTER();
+    TRANSACTIONS_ENCODERS_MASTER();
+    TRANSACTIONS_POINTING_MASTER();
+    TRANSACTIONS_STREAM_MASTER();
+    return true;
+#else  // SPLIT_TRANSPORT_BATCH
     TRANSACTIONS_SLAVE_MATRIX_MASTER();
     TRANSACTIONS_MASTER_MATRIX_MASTER();
     TRANSACTIONS_ENCODERS_MASTER();
@@ -974,7 +2039,9 @@ bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix
     TRANSACTIONS_HAPTIC_MASTER();
     TRANSACTIONS_ACTIVITY_MASTER();
     TRANSACTIONS_DETECTED_OS_MASTER();
+    TRANSACTIONS_STREAM_MASTER();
     return true;
+#endif // SPLIT_TRANSPORT_BATCH
 }
 
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
@@ -997,13 +2064,15 @@ void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[
     TRANSACTIONS_HAPTIC_SLAVE();
     TRANSACTIONS_ACTIVITY_SLAVE();
     TRANSACTIONS_DETECTED_OS_SLAVE();
+    TRANSACTIONS_STREAM_SLAVE();
+    TRANSACTIONS_PUSH_SLAVE();
 }
 
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 void transaction_register_rpc(int8_t transaction_id, slave_callback_t callback) {
     // Prevent invoking RPC on QMK core sync data
-    if (transaction_id <= GET_RPC_RESP_DATA) return;
+    if (transaction_id <= LAST_CORE_TRANSACTION) return;
 
     // Set the callback
     split_transaction_table[transaction_id].slave_callback          = callback;
@@ -1017,7 +2086,7 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
         return false;
     }
     // Prevent invoking RPC on QMK core sync data
-    if (transaction_id <= GET_RPC_RESP_DATA) return false;
+    if (transaction_id <= LAST_CORE_TRANSACTION) return false;
     // Prevent sizing issues
     if (initiator2target_buffer_size > RPC_M2S_BUFFER_SIZE) return false;
     if (target2initiator_buffer_size > RPC_S2M_BUFFER_SIZE) return false;
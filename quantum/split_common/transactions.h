@@ -25,6 +25,11 @@
 
 typedef void (*slave_callback_t)(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer);
 
+#if defined(SPLIT_TRANSPORT_BATCH) || defined(SPLIT_TRANSPORT_DELTA) || defined(SPLIT_STREAM_ENABLE)
+// The first byte of both buffers holds the number of bytes following it, the rest is not transferred
+#    define SPLIT_TRANSACTION_LENGTH_PREFIXED (1 << 0)
+#endif // defined(SPLIT_TRANSPORT_BATCH) || defined(SPLIT_TRANSPORT_DELTA) || defined(SPLIT_STREAM_ENABLE)
+
 // Split transaction Descriptor
 typedef struct _split_transaction_desc_t {
     uint8_t          initiator2target_buffer_size;
@@ -32,6 +37,9 @@ typedef struct _split_transaction_desc_t {
     uint8_t          target2initiator_buffer_size;
     uint16_t         target2initiator_offset;
     slave_callback_t slave_callback;
+#ifdef SPLIT_TRANSACTION_LENGTH_PREFIXED
+    uint8_t          flags;
+#endif // SPLIT_TRANSACTION_LENGTH_PREFIXED
 } split_transaction_desc_t;
 
 // Forward declaration for the split transactions
@@ -41,6 +49,16 @@ extern split_transaction_desc_t split_transaction_table[NUM_TOTAL_TRANSACTIONS];
 #define split_trans_initiator2target_buffer(trans) (split_shmem_offset_ptr((trans)->initiator2target_offset))
 #define split_trans_target2initiator_buffer(trans) (split_shmem_offset_ptr((trans)->target2initiator_offset))
 
+// Number of bytes of a transaction buffer actually on the wire
+static inline uint8_t split_trans_buffer_length(const split_transaction_desc_t *trans, const uint8_t *buffer, uint8_t size) {
+#ifdef SPLIT_TRANSACTION_LENGTH_PREFIXED
+    if (size > 0 && (trans->flags & SPLIT_TRANSACTION_LENGTH_PREFIXED)) {
+        return buffer[0] < size ? buffer[0] + 1 : size;
+    }
+#endif // SPLIT_TRANSACTION_LENGTH_PREFIXED
+    return size;
+}
+
 // returns false if valid data not received from slave
 bool transactions_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 void transactions_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
@@ -51,3 +69,22 @@ bool transaction_rpc_exec(int8_t transaction_id, uint8_t initiator2target_buffer
 
 #define transaction_rpc_send(transaction_id, initiator2target_buffer_size, initiator2target_buffer) transaction_rpc_exec(transaction_id, initiator2target_buffer_size, initiator2target_buffer, 0, NULL)
 #define transaction_rpc_recv(transaction_id, target2initiator_buffer_size, target2initiator_buffer) transaction_rpc_exec(transaction_id, 0, NULL, target2initiator_buffer_size, target2initiator_buffer)
+
+#ifdef SPLIT_STREAM_ENABLE
+#    include "deferred_exec.h"
+
+// Called on the master when a transfer is over, with the number of bytes moved
+typedef void (*split_stream_callback_t)(int8_t transaction_id, bool success, uint16_t length, void *cb_arg);
+// Called on the slave from its main loop once a transfer to its stream buffer is complete
+typedef void (*split_stream_received_t)(int8_t transaction_id, const void *data, uint16_t length);
+
+// Exposes the given buffer on the slave, as the target of transfers to the stream and the source of transfers from it
+void transaction_register_stream(int8_t transaction_id, void *buffer, uint16_t size, split_stream_received_t callback);
+
+// Moves the data to the slave's stream buffer a fragment at a time, the data needs to stay valid until the callback
+deferred_token transaction_stream_send(int8_t transaction_id, const void *data, uint16_t length, split_stream_callback_t callback, void *cb_arg);
+// Reads the slave's stream buffer, up to the given size, a fragment at a time
+deferred_token transaction_stream_recv(int8_t transaction_id, void *buffer, uint16_t size, split_stream_callback_t callback, void *cb_arg);
+// Stops a transfer, without calling its callback
+bool transaction_stream_cancel(deferred_token token);
+#endif // SPLIT_STREAM_ENABLE
@@ -21,6 +21,32 @@
 #include "transport.h"
 #include "transaction_id_define.h"
 #include "atomic_util.h"
+#include "profiling.h"
+#include "util.h"
+
+#ifdef SPLIT_TRANSPORT_STATS
+#    include "keyboard.h"
+#    include "timer.h"
+
+// Moves a transaction over the link, for transport_execute_transaction() to account for
+static bool transport_transfer(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
+#else
+#    define transport_transfer transport_execute_transaction
+#endif // SPLIT_TRANSPORT_STATS
+
+#if defined(SPLIT_TRANSPORT_PUSH) && defined(SPLIT_PUSH_PIN)
+#    include "gpio.h"
+
+#    define push_pin_init_master() gpio_set_pin_input_high(SPLIT_PUSH_PIN)
+#    define push_pin_init_slave()                \
+        do {                                     \
+            gpio_set_pin_output(SPLIT_PUSH_PIN); \
+            gpio_write_pin_high(SPLIT_PUSH_PIN); \
+        } while (0)
+#else
+#    define push_pin_init_master()
+#    define push_pin_init_slave()
+#endif // defined(SPLIT_TRANSPORT_PUSH) && defined(SPLIT_PUSH_PIN)
 
 #ifdef USE_I2C
 
@@ -41,9 +67,11 @@ _Static_assert(sizeof(split_shared_memory_t) <= I2C_SLAVE_REG_COUNT, "split_shar
 split_shared_memory_t *const split_shmem = (split_shared_memory_t *)i2c_slave_reg;
 
 void transport_master_init(void) {
+    push_pin_init_master();
     i2c_init();
 }
 void transport_slave_init(void) {
+    push_pin_init_slave();
     i2c_slave_init(SLAVE_I2C_ADDRESS);
 }
 
@@ -59,12 +87,13 @@ i2c_status_t transport_trigger_callback(int8_t id) {
     return i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size, SLAVE_I2C_TIMEOUT);
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+bool transport_transfer(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     i2c_status_t              status;
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
         memcpy(split_trans_initiator2target_buffer(trans), initiator2target_buf, len);
+        len = split_trans_buffer_length(trans, split_trans_initiator2target_buffer(trans), len);
         if ((status = i2c_write_register(SLAVE_I2C_ADDRESS, trans->initiator2target_offset, split_trans_initiator2target_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
@@ -77,6 +106,20 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
     if (target2initiator_length > 0) {
         size_t len = trans->target2initiator_buffer_size < target2initiator_length ? trans->target2initiator_buffer_size : target2initiator_length;
+#    ifdef SPLIT_TRANSACTION_LENGTH_PREFIXED
+        if (trans->flags & SPLIT_TRANSACTION_LENGTH_PREFIXED) {
+            // Read the length first, then only what follows it
+            uint8_t *buffer = split_trans_target2initiator_buffer(trans);
+            if ((status = i2c_read_register(SLAVE_I2C_ADDRESS, trans->target2initiator_offset, buffer, 1, SLAVE_I2C_TIMEOUT)) < 0 || buffer[0] >= trans->target2initiator_buffer_size) {
+                return false;
+            }
+            if (buffer[0] > 0 && (status = i2c_read_register(SLAVE_I2C_ADDRESS, trans->target2initiator_offset + 1, buffer + 1, buffer[0], SLAVE_I2C_TIMEOUT)) < 0) {
+                return false;
+            }
+            memcpy(target2initiator_buf, buffer, MIN(len, 1 + buffer[0]));
+            return true;
+        }
+#    endif // SPLIT_TRANSACTION_LENGTH_PREFIXED
         if ((status = i2c_read_register(SLAVE_I2C_ADDRESS, trans->target2initiator_offset, split_trans_target2initiator_buffer(trans), len, SLAVE_I2C_TIMEOUT)) < 0) {
             return false;
         }
@@ -94,13 +137,15 @@ static split_shared_memory_t shared_memory;
 split_shared_memory_t *const split_shmem = &shared_memory;
 
 void transport_master_init(void) {
+    push_pin_init_master();
     soft_serial_initiator_init();
 }
 void transport_slave_init(void) {
+    push_pin_init_slave();
     soft_serial_target_init();
 }
 
-bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+bool transport_transfer(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
     split_transaction_desc_t *trans = &split_transaction_table[id];
     if (initiator2target_length > 0) {
         size_t len = trans->initiator2target_buffer_size < initiator2target_length ? trans->initiator2target_buffer_size : initiator2target_length;
@@ -121,10 +166,141 @@ bool transport_execute_transaction(int8_t id, const void *initiator2target_buf,
 
 #endif // USE_I2C
 
+#ifdef SPLIT_TRANSPORT_PUSH
+
+#    ifdef SPLIT_PUSH_PIN
+// Pulled low by the slave while it has something the master hasn't read
+bool transport_slave_attention(void) {
+    return !gpio_read_pin(SPLIT_PUSH_PIN);
+}
+
+void transport_slave_signal(bool pending) {
+    gpio_write_pin(SPLIT_PUSH_PIN, !pending);
+}
+#    elif defined(USE_I2C)
+#        error "SPLIT_TRANSPORT_PUSH over I2C needs a wake line, set SPLIT_PUSH_PIN"
+#    elif defined(SERIAL_DRIVER_BITBANG) || defined(__AVR__)
+#        error "SPLIT_TRANSPORT_PUSH over the bitbang serial driver needs a wake line, set SPLIT_PUSH_PIN"
+#    else
+bool transport_slave_attention(void) {
+    return soft_serial_attention();
+}
+
+void transport_slave_signal(bool pending) {
+    soft_serial_signal(pending);
+}
+#    endif // SPLIT_PUSH_PIN
+
+#endif // SPLIT_TRANSPORT_PUSH
+
+#ifdef SPLIT_TRANSPORT_STATS
+
+#    ifndef SPLIT_TRANSPORT_STATS_PRINT_INTERVAL
+#        define SPLIT_TRANSPORT_STATS_PRINT_INTERVAL 10000
+#    endif // SPLIT_TRANSPORT_STATS_PRINT_INTERVAL
+
+static split_transaction_stats_t transaction_stats[NUM_TOTAL_TRANSACTIONS];
+// Whether the last attempt of each transaction failed, making the next one a retry
+static bool   transaction_failing[NUM_TOTAL_TRANSACTIONS];
+static int8_t last_failed = -1;
+
+// Bytes of the buffers a successful transaction moved
+static uint16_t transport_transfer_bytes(int8_t id, uint16_t initiator2target_length, uint16_t target2initiator_length) {
+    split_transaction_desc_t *trans = &split_transaction_table[id];
+#    ifdef USE_I2C
+    // Only the buffers asked for go over the bus
+    uint16_t bytes = 0;
+    if (initiator2target_length > 0) {
+        bytes += split_trans_buffer_length(trans, split_trans_initiator2target_buffer(trans), MIN(trans->initiator2target_buffer_size, initiator2target_length));
+    }
+    if (target2initiator_length > 0) {
+        bytes += split_trans_buffer_length(trans, split_trans_target2initiator_buffer(trans), MIN(trans->target2initiator_buffer_size, target2initiator_length));
+    }
+    return bytes;
+#    else
+    // The serial protocol always exchanges both buffers
+    return split_trans_buffer_length(trans, split_trans_initiator2target_buffer(trans), trans->initiator2target_buffer_size) + split_trans_buffer_length(trans, split_trans_target2initiator_buffer(trans), trans->target2initiator_buffer_size);
+#    endif // USE_I2C
+}
+
+bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length) {
+    uint32_t start = timer_read_cycles();
+    bool     okay  = transport_transfer(id, initiator2target_buf, initiator2target_length, target2initiator_buf, target2initiator_length);
+    uint32_t rtt   = timer_read_cycles() - start;
+
+    if (id < 0 || id >= NUM_TOTAL_TRANSACTIONS) {
+        return okay;
+    }
+    split_transaction_stats_t *stats = &transaction_stats[id];
+    stats->attempts++;
+    if (transaction_failing[id]) {
+        stats->retries++;
+    }
+    transaction_failing[id] = !okay;
+    if (!okay) {
+        stats->failures++;
+        last_failed = id;
+        return false;
+    }
+    stats->bytes += transport_transfer_bytes(id, initiator2target_length, target2initiator_length);
+    if (stats->rtt_total == 0 || rtt < stats->rtt_min) {
+        stats->rtt_min = rtt;
+    }
+    if (rtt > stats->rtt_max) {
+        stats->rtt_max = rtt;
+    }
+    stats->rtt_total += rtt;
+    return true;
+}
+
+const split_transaction_stats_t *split_transaction_stats_get(int8_t id) {
+    return id >= 0 && id < NUM_TOTAL_TRANSACTIONS ? &transaction_stats[id] : NULL;
+}
+
+int8_t split_transaction_stats_last_failed(void) {
+    return last_failed;
+}
+
+void split_transaction_stats_reset(void) {
+    memset(transaction_stats, 0, sizeof(transaction_stats));
+    memset(transaction_failing, 0, sizeof(transaction_failing));
+    last_failed = -1;
+}
+
+void split_transaction_stats_print(void) {
+#    ifdef CONSOLE_ENABLE
+    for (int8_t id = 0; id < NUM_TOTAL_TRANSACTIONS; id++) {
+        const split_transaction_stats_t *stats = &transaction_stats[id];
+        if (stats->attempts == 0) {
+            continue;
+        }
+        uint32_t successes = stats->attempts - stats->failures;
+        uint32_t avg       = successes ? (uint32_t)(stats->rtt_total / successes) : 0;
+        uprintf("split %d -- attempts: %lu, failures: %lu, retries: %lu, bytes: %lu, rtt min: %lu, avg: %lu, max: %lu\n", id, (unsigned long)stats->attempts, (unsigned long)stats->failures, (unsigned long)stats->retries, (unsigned long)stats->bytes, (unsigned long)stats->rtt_min, (unsigned long)avg, (unsigned long)stats->rtt_max);
+    }
+#    endif // CONSOLE_ENABLE
+}
+
+void split_transaction_stats_task(void) {
+#    if SPLIT_TRANSPORT_STATS_PRINT_INTERVAL > 0
+    static uint32_t last_print = 0;
+    if (timer_elapsed32(last_print) >= SPLIT_TRANSPORT_STATS_PRINT_INTERVAL) {
+        last_print = timer_read32();
+        if (debug_enable && is_keyboard_master()) {
+            split_transaction_stats_print();
+        }
+    }
+#    endif // SPLIT_TRANSPORT_STATS_PRINT_INTERVAL > 0
+}
+
+#endif // SPLIT_TRANSPORT_STATS
+
 bool transport_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    return transactions_master(master_matrix, slave_matrix);
+    bool okay;
+    PROFILE_ZONE_NAMED("transactions_master", okay = transactions_master(master_matrix, slave_matrix));
+    return okay;
 }
 
 void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    transactions_slave(master_matrix, slave_matrix);
+    PROFILE_ZONE_NAMED("transactions_slave", transactions_slave(master_matrix, slave_matrix));
 }
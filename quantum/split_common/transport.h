@@ -31,6 +31,41 @@
 #    define RPC_S2M_BUFFER_SIZE 32
 #endif // RPC_S2M_BUFFER_SIZE
 
+#ifdef SPLIT_TRANSPORT_BATCH
+#    ifndef SPLIT_TRANSPORT_BATCH_SIZE
+#        define SPLIT_TRANSPORT_BATCH_SIZE 64
+#    endif // SPLIT_TRANSPORT_BATCH_SIZE
+#    ifndef SPLIT_TRANSPORT_BATCH_MIN_WRITES
+// A frame costs a transaction and the bytes of its header, which a single write only makes up for on I2C
+#        ifdef USE_I2C
+#            define SPLIT_TRANSPORT_BATCH_MIN_WRITES 1
+#        else
+#            define SPLIT_TRANSPORT_BATCH_MIN_WRITES 2
+#        endif // USE_I2C
+#    endif // SPLIT_TRANSPORT_BATCH_MIN_WRITES
+#    if SPLIT_TRANSPORT_BATCH_SIZE > 255
+#        error "SPLIT_TRANSPORT_BATCH_SIZE must fit the length byte of the frame"
+#    endif
+#endif // SPLIT_TRANSPORT_BATCH
+
+#ifdef SPLIT_TRANSPORT_DELTA
+#    ifndef SPLIT_TRANSPORT_DELTA_EVENTS
+#        define SPLIT_TRANSPORT_DELTA_EVENTS 16
+#    endif // SPLIT_TRANSPORT_DELTA_EVENTS
+#    if (SPLIT_TRANSPORT_DELTA_EVENTS & (SPLIT_TRANSPORT_DELTA_EVENTS - 1)) != 0 || SPLIT_TRANSPORT_DELTA_EVENTS > 64
+#        error "SPLIT_TRANSPORT_DELTA_EVENTS must be a power of two no larger than 64"
+#    endif
+#endif // SPLIT_TRANSPORT_DELTA
+
+#ifdef SPLIT_STREAM_ENABLE
+#    ifndef SPLIT_STREAM_FRAGMENT_SIZE
+#        define SPLIT_STREAM_FRAGMENT_SIZE 32
+#    endif // SPLIT_STREAM_FRAGMENT_SIZE
+#    if SPLIT_STREAM_FRAGMENT_SIZE > 240
+#        error "SPLIT_STREAM_FRAGMENT_SIZE must leave room for the fragment header within 255 bytes"
+#    endif
+#endif // SPLIT_STREAM_ENABLE
+
 void transport_master_init(void);
 void transport_slave_init(void);
 
@@ -40,6 +75,38 @@ void transport_slave(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]);
 
 bool transport_execute_transaction(int8_t id, const void *initiator2target_buf, uint16_t initiator2target_length, void *target2initiator_buf, uint16_t target2initiator_length);
 
+#ifdef SPLIT_TRANSPORT_PUSH
+// Whether the slave has asked for its data to be read, on the master
+bool transport_slave_attention(void);
+// Asks the master for attention while there is something it hasn't read yet, on the slave
+void transport_slave_signal(bool pending);
+#endif // SPLIT_TRANSPORT_PUSH
+
+#ifdef SPLIT_TRANSPORT_STATS
+// Link statistics of a transaction, round trip times in timer_read_cycles() units
+typedef struct _split_transaction_stats_t {
+    uint32_t attempts;
+    uint32_t failures;
+    // Attempts following a failure of the same transaction
+    uint32_t retries;
+    // Buffer bytes moved by the successful attempts
+    uint32_t bytes;
+    uint32_t rtt_min;
+    uint32_t rtt_max;
+    // Of the successful attempts
+    uint64_t rtt_total;
+} split_transaction_stats_t;
+
+// Statistics of the given transaction ID, NULL if out of range
+const split_transaction_stats_t *split_transaction_stats_get(int8_t id);
+// The ID of the last transaction that failed, -1 if none did
+int8_t split_transaction_stats_last_failed(void);
+void   split_transaction_stats_reset(void);
+void   split_transaction_stats_print(void);
+// Prints the statistics every SPLIT_TRANSPORT_STATS_PRINT_INTERVAL while debugging, on the master
+void split_transaction_stats_task(void);
+#endif // SPLIT_TRANSPORT_STATS
+
 #ifdef ENCODER_ENABLE
 #    include "encoder.h"
 #endif // ENCODER_ENABLE
@@ -57,6 +124,35 @@ typedef struct _split_slave_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
 } split_slave_matrix_sync_t;
 
+#ifdef SPLIT_TRANSPORT_DELTA
+// A key position in the slave's half, row * MATRIX_COLS + column, with the top bit set when pressed
+#    if ((MATRIX_ROWS) / 2) * (MATRIX_COLS) <= 128
+typedef uint8_t split_delta_event_t;
+#    else
+typedef uint16_t split_delta_event_t;
+#    endif
+#    define SPLIT_DELTA_EVENT_PRESSED ((split_delta_event_t)1 << (sizeof(split_delta_event_t) * 8 - 1))
+
+// Asks for what changed after the given sequence number
+typedef struct _split_delta_request_t {
+    uint8_t length;
+    uint8_t since;
+} split_delta_request_t;
+
+// The changes after the requested sequence number up to the given one, none if they are no longer known
+typedef struct _split_slave_matrix_delta_reply_t {
+    uint8_t             length;
+    uint8_t             sequence;
+    uint8_t             checksum;
+    split_delta_event_t events[SPLIT_TRANSPORT_DELTA_EVENTS];
+} split_slave_matrix_delta_reply_t;
+
+typedef struct _split_slave_matrix_delta_t {
+    split_delta_request_t            request;
+    split_slave_matrix_delta_reply_t reply;
+} split_slave_matrix_delta_t;
+#endif // SPLIT_TRANSPORT_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
 typedef struct _split_master_matrix_sync_t {
     matrix_row_t matrix[(MATRIX_ROWS) / 2];
@@ -113,6 +209,22 @@ typedef struct _split_slave_pointing_sync_t {
     report_mouse_t report;
     uint16_t       cpi;
 } split_slave_pointing_sync_t;
+
+#    ifdef SPLIT_TRANSPORT_DELTA
+// The motion not yet acknowledged by requesting with the given sequence number, only of the axes set in axes
+typedef struct _split_slave_pointing_delta_reply_t {
+    uint8_t length;
+    uint8_t sequence;
+    uint8_t buttons;
+    uint8_t axes;
+    uint8_t values[8];
+} split_slave_pointing_delta_reply_t;
+
+typedef struct _split_slave_pointing_delta_t {
+    split_delta_request_t              request;
+    split_slave_pointing_delta_reply_t reply;
+} split_slave_pointing_delta_t;
+#    endif // SPLIT_TRANSPORT_DELTA
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
 #if defined(HAPTIC_ENABLE) && defined(SPLIT_HAPTIC_ENABLE)
@@ -141,8 +253,59 @@ typedef struct _rpc_sync_info_t {
         uint8_t s2m_length;
     } payload;
 } rpc_sync_info_t;
+
+#    ifdef SPLIT_STREAM_ENABLE
+#        define SPLIT_STREAM_WRITE (1 << 0)
+#        define SPLIT_STREAM_START (1 << 1)
+#        define SPLIT_STREAM_END (1 << 2)
+// Sent ahead of the first write to a stream after the master boots, as its sequence numbers start over
+#        define SPLIT_STREAM_SYNC (1 << 3)
+
+// A fragment of a transfer to the slave's stream buffer, or a request for one from it
+typedef struct _split_stream_request_t {
+    uint8_t  length;
+    uint8_t  checksum;
+    uint16_t offset;
+    int8_t   transaction_id;
+    uint8_t  sequence;
+    uint8_t  flags;
+    // The bytes carried by a write, or wanted by a read
+    uint8_t count;
+    uint8_t data[SPLIT_STREAM_FRAGMENT_SIZE];
+} split_stream_request_t;
+
+enum {
+    SPLIT_STREAM_OK,
+    // The slave hasn't handed the last transfer to its stream to the keymap yet
+    SPLIT_STREAM_BUSY,
+    // Out of the stream buffer, out of order, or to a stream that isn't registered
+    SPLIT_STREAM_REJECTED,
+    SPLIT_STREAM_CORRUPT,
+};
+
+typedef struct _split_stream_reply_t {
+    uint8_t  length;
+    uint8_t  checksum;
+    uint16_t size;
+    uint8_t  sequence;
+    uint8_t  status;
+    uint8_t  data[SPLIT_STREAM_FRAGMENT_SIZE];
+} split_stream_reply_t;
+
+typedef struct _split_stream_sync_t {
+    split_stream_request_t request;
+    split_stream_reply_t   reply;
+} split_stream_sync_t;
+#    endif // SPLIT_STREAM_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+typedef struct _split_batch_sync_t {
+    uint8_t m2s[SPLIT_TRANSPORT_BATCH_SIZE];
+    uint8_t s2m[SPLIT_TRANSPORT_BATCH_SIZE];
+} split_batch_sync_t;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
 #    include "os_detection.h"
 #endif // defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -154,6 +317,10 @@ typedef struct _split_shared_memory_t {
 
     split_slave_matrix_sync_t smatrix;
 
+#ifdef SPLIT_TRANSPORT_DELTA
+    split_slave_matrix_delta_t smatrix_delta;
+#endif // SPLIT_TRANSPORT_DELTA
+
 #ifdef SPLIT_TRANSPORT_MIRROR
     split_master_matrix_sync_t mmatrix;
 #endif // SPLIT_TRANSPORT_MIRROR
@@ -208,6 +375,9 @@ typedef struct _split_shared_memory_t {
 
 #if defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
     split_slave_pointing_sync_t pointing;
+#    ifdef SPLIT_TRANSPORT_DELTA
+    split_slave_pointing_delta_t pointing_delta;
+#    endif // SPLIT_TRANSPORT_DELTA
 #endif // defined(POINTING_DEVICE_ENABLE) && defined(SPLIT_POINTING_ENABLE)
 
 #if defined(SPLIT_WATCHDOG_ENABLE)
@@ -222,10 +392,17 @@ typedef struct _split_shared_memory_t {
     split_slave_activity_sync_t activity_sync;
 #endif // defined(SPLIT_ACTIVITY_ENABLE)
 
+#ifdef SPLIT_TRANSPORT_BATCH
+    split_batch_sync_t batch;
+#endif // SPLIT_TRANSPORT_BATCH
+
 #if defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
     rpc_sync_info_t rpc_info;
     uint8_t         rpc_m2s_buffer[RPC_M2S_BUFFER_SIZE];
     uint8_t         rpc_s2m_buffer[RPC_S2M_BUFFER_SIZE];
+#    ifdef SPLIT_STREAM_ENABLE
+    split_stream_sync_t stream;
+#    endif // SPLIT_STREAM_ENABLE
 #endif // defined(SPLIT_TRANSACTION_IDS_KB) || defined(SPLIT_TRANSACTION_IDS_USER)
 
 #if defined(OS_DETECTION_ENABLE) && defined(SPLIT_DETECTED_OS_ENABLE)
@@ -24,6 +24,11 @@
 
 #include "vial_ensure_keycode.h"
 
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSPORT_STATS)
+#include "transport.h"
+#include "transaction_id_define.h"
+#endif
+
 #define VIAL_UNLOCK_COUNTER_MAX 50
 
 #ifdef VIAL_INSECURE
@@ -287,6 +292,150 @@ void vial_handle_cmd(uint8_t *msg, uint8_t length) {
 
             break;
         }
+#ifdef KEY_LATENCY_ENABLE
+        case vial_key_latency_op: {
+            switch (msg[2]) {
+            case vial_key_latency_get_info: {
+                uint32_t dropped = key_latency_get_dropped();
+                memset(msg, 0, length);
+                msg[0] = KEY_LATENCY_STAGE_COUNT;
+                msg[1] = KEY_LATENCY_BUCKETS;
+                msg[2] = KEY_LATENCY_BUCKET_WIDTH & 0xFF;
+                msg[3] = KEY_LATENCY_BUCKET_WIDTH >> 8;
+                msg[4] = dropped & 0xFF;
+                msg[5] = (dropped >> 8) & 0xFF;
+                msg[6] = (dropped >> 16) & 0xFF;
+                msg[7] = (dropped >> 24) & 0xFF;
+                break;
+            }
+            case vial_key_latency_get_summary: {
+                const key_latency_histogram_t *histogram = key_latency_get_histogram(msg[3]);
+                memset(msg, 0, length);
+                if (histogram == NULL) {
+                    msg[0] = 1;
+                    break;
+                }
+                msg[1] = histogram->count & 0xFF;
+                msg[2] = (histogram->count >> 8) & 0xFF;
+                msg[3] = (histogram->count >> 16) & 0xFF;
+                msg[4] = (histogram->count >> 24) & 0xFF;
+                for (uint8_t i = 0; i < 4; ++i) {
+                    msg[5 + i] = (histogram->min >> (i * 8)) & 0xFF;
+                    msg[9 + i] = (histogram->max >> (i * 8)) & 0xFF;
+                }
+                for (uint8_t i = 0; i < 8; ++i) {
+                    msg[13 + i] = (histogram->sum >> (i * 8)) & 0xFF;
+                }
+                break;
+            }
+            case vial_key_latency_get_buckets: {
+                const key_latency_histogram_t *histogram = key_latency_get_histogram(msg[3]);
+                uint8_t first = msg[4];
+                memset(msg, 0, length);
+                if (histogram == NULL || first >= KEY_LATENCY_BUCKETS) {
+                    msg[0] = 1;
+                    break;
+                }
+                /* As many buckets as fit after the status and count bytes */
+                uint8_t count = MIN(KEY_LATENCY_BUCKETS - first, (length - 2) / 2);
+                msg[1] = count;
+                for (uint8_t i = 0; i < count; ++i) {
+                    msg[2 + i * 2] = histogram->buckets[first + i] & 0xFF;
+                    msg[2 + i * 2 + 1] = histogram->buckets[first + i] >> 8;
+                }
+                break;
+            }
+            case vial_key_latency_reset: {
+                key_latency_reset();
+                break;
+            }
+            }
+
+            break;
+        }
+#endif
+#ifdef PROFILING_ENABLE
+        case vial_profiling_op: {
+            switch (msg[2]) {
+            case vial_profiling_get_count: {
+                memset(msg, 0, length);
+                msg[0] = profiling_zone_count();
+                break;
+            }
+            case vial_profiling_get_zone: {
+                const profiling_zone_t *zone = profiling_zone_at(msg[3]);
+                memset(msg, 0, length);
+                if (zone == NULL) {
+                    msg[0] = 1;
+                    break;
+                }
+                uint32_t stats[4] = {
+                    zone->calls,
+                    zone->min,
+                    zone->max,
+                    zone->calls ? (uint32_t)(zone->total / zone->calls) : 0,
+                };
+                for (size_t i = 0; i < 4; ++i) {
+                    msg[1 + i * 4] = stats[i] & 0xFF;
+                    msg[1 + i * 4 + 1] = (stats[i] >> 8) & 0xFF;
+                    msg[1 + i * 4 + 2] = (stats[i] >> 16) & 0xFF;
+                    msg[1 + i * 4 + 3] = (stats[i] >> 24) & 0xFF;
+                }
+                /* Name fills the rest, truncated and always NUL terminated */
+                strncpy((char *)&msg[17], zone->name, length - 17 - 1);
+                break;
+            }
+            case vial_profiling_reset: {
+                profiling_reset();
+                break;
+            }
+            }
+
+            break;
+        }
+#endif
+#if defined(SPLIT_KEYBOARD) && defined(SPLIT_TRANSPORT_STATS)
+        case vial_split_stats_op: {
+            switch (msg[2]) {
+            case vial_split_stats_get_count: {
+                memset(msg, 0, length);
+                msg[0] = NUM_TOTAL_TRANSACTIONS;
+                break;
+            }
+            case vial_split_stats_get: {
+                const split_transaction_stats_t *trans = split_transaction_stats_get(msg[3]);
+                memset(msg, 0, length);
+                if (trans == NULL) {
+                    msg[0] = 1;
+                    break;
+                }
+                uint32_t successes = trans->attempts - trans->failures;
+                uint32_t stats[7] = {
+                    trans->attempts,
+                    trans->failures,
+                    trans->retries,
+                    trans->bytes,
+                    trans->rtt_min,
+                    trans->rtt_max,
+                    successes ? (uint32_t)(trans->rtt_total / successes) : 0,
+                };
+                for (size_t i = 0; i < 7; ++i) {
+                    msg[1 + i * 4] = stats[i] & 0xFF;
+                    msg[1 + i * 4 + 1] = (stats[i] >> 8) & 0xFF;
+                    msg[1 + i * 4 + 2] = (stats[i] >> 16) & 0xFF;
+                    msg[1 + i * 4 + 3] = (stats[i] >> 24) & 0xFF;
+                }
+                break;
+            }
+            case vial_split_stats_reset: {
+                split_transaction_stats_reset();
+                break;
+            }
+            }
+
+            break;
+        }
+#endif
     }
 }
 
@@ -525,6 +674,10 @@ static void reload_combo(void) {
             key_combos[i].keycode = entry.output;
         }
     }
+
+#ifdef COMBO_KEY_INDEX
+    combo_key_index_rebuild();
+#endif
 }
 #endif
 
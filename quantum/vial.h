@@ -48,6 +48,9 @@ enum {
     vial_qmk_settings_set = 0x0B,
     vial_qmk_settings_reset = 0x0C,
     vial_dynamic_entry_op = 0x0D,  /* operate on tapdance, combos, etc */
+    vial_key_latency_op = 0x0E,
+    vial_profiling_op = 0x0F,
+    vial_split_stats_op = 0x10,
 };
 
 enum {
@@ -60,6 +63,25 @@ enum {
     dynamic_vial_key_override_set = 0x06,
 };
 
+enum {
+    vial_key_latency_get_info = 0x00,
+    vial_key_latency_get_summary = 0x01,
+    vial_key_latency_get_buckets = 0x02,
+    vial_key_latency_reset = 0x03,
+};
+
+enum {
+    vial_profiling_get_count = 0x00,
+    vial_profiling_get_zone = 0x01,
+    vial_profiling_reset = 0x02,
+};
+
+enum {
+    vial_split_stats_get_count = 0x00,
+    vial_split_stats_get = 0x01,
+    vial_split_stats_reset = 0x02,
+};
+
 #define VIAL_MACRO_EXT_TAP 5
 #define VIAL_MACRO_EXT_DOWN 6
 #define VIAL_MACRO_EXT_UP 7
@@ -110,6 +110,117 @@ static void fast_set_leds(uint8_t *args, size_t length) {
 }
 #endif
 
+#ifdef VIALRGB_DIRECT_STREAM
+/* One frame is being built while the other waits to be shown, g_direct_mode_colors is on display */
+static HSV stream_frames[2][RGB_MATRIX_LED_COUNT];
+static HSV stream_palette[VIALRGB_STREAM_PALETTE_SIZE];
+static uint8_t stream_back;
+static bool stream_building;
+static uint8_t stream_building_seq;
+static bool stream_pending;
+static uint8_t stream_pending_seq;
+static uint8_t stream_shown_seq;
+static uint8_t stream_dropped;
+
+static void stream_set_hsv(HSV *color, const uint8_t *hsv) {
+    color->h = hsv[0];
+    color->s = hsv[1];
+    color->v = (hsv[2] > RGB_MATRIX_MAXIMUM_BRIGHTNESS) ? RGB_MATRIX_MAXIMUM_BRIGHTNESS : hsv[2];
+}
+
+static HSV *stream_frame(uint8_t seq) {
+    /* the first packet with a new sequence number starts the frame from the latest committed one */
+    if (!stream_building || seq != stream_building_seq) {
+        const HSV *base = stream_pending ? stream_frames[stream_back ^ 1] : g_direct_mode_colors;
+        memcpy(stream_frames[stream_back], base, sizeof(stream_frames[stream_back]));
+        stream_building = true;
+        stream_building_seq = seq;
+    }
+    return stream_frames[stream_back];
+}
+
+static uint8_t stream_leds(HSV *frame, uint16_t first_led, uint8_t num_leds, const uint8_t *hsv) {
+    if (first_led + num_leds > RGB_MATRIX_LED_COUNT) return vialrgb_stream_invalid;
+    for (uint8_t i = 0; i < num_leds; ++i)
+        stream_set_hsv(&frame[first_led + i], &hsv[i * 3]);
+    return vialrgb_stream_ok;
+}
+
+static uint8_t stream_indexed(HSV *frame, uint16_t first_led, uint8_t num_leds, const uint8_t *indices) {
+    if (first_led + num_leds > RGB_MATRIX_LED_COUNT) return vialrgb_stream_invalid;
+    for (uint8_t i = 0; i < num_leds; ++i) {
+        uint8_t index = (i & 1) ? indices[i / 2] >> 4 : indices[i / 2] & 0x0F;
+        frame[first_led + i] = stream_palette[index];
+    }
+    return vialrgb_stream_ok;
+}
+
+static uint8_t stream_delta(HSV *frame, uint16_t led, const uint8_t *runs, size_t length) {
+    /* every run skips the LEDs that did not change since the previous frame */
+    while (length >= 2) {
+        uint8_t skip = runs[0];
+        uint8_t num_leds = runs[1];
+        runs += 2;
+        length -= 2;
+        if (num_leds == 0) break;
+        if ((size_t)num_leds * 3 > length) return vialrgb_stream_invalid;
+        led += skip;
+        if (stream_leds(frame, led, num_leds, runs) != vialrgb_stream_ok) return vialrgb_stream_invalid;
+        led += num_leds;
+        runs += num_leds * 3;
+        length -= num_leds * 3;
+    }
+    return vialrgb_stream_ok;
+}
+
+static uint8_t stream_commit(uint8_t seq) {
+    if (!stream_building || seq != stream_building_seq) return vialrgb_stream_invalid;
+    if (stream_pending) ++stream_dropped;
+    stream_back ^= 1;
+    stream_building = false;
+    stream_pending = true;
+    stream_pending_seq = seq;
+    return vialrgb_stream_ok;
+}
+
+static uint8_t stream_packet(const uint8_t *args, size_t length) {
+    if (length < 2) return vialrgb_stream_invalid;
+
+    uint8_t seq = args[0];
+    uint8_t format = args[1];
+    args += 2;
+    length -= 2;
+
+    switch (format) {
+    case vialrgb_stream_hsv:
+        if (length < 3 || (size_t)args[2] * 3 > length - 3) return vialrgb_stream_invalid;
+        return stream_leds(stream_frame(seq), args[0] | (args[1] << 8), args[2], &args[3]);
+    case vialrgb_stream_palette:
+        if (length < 2 || (size_t)args[1] * 3 > length - 2) return vialrgb_stream_invalid;
+        if (args[0] + args[1] > VIALRGB_STREAM_PALETTE_SIZE) return vialrgb_stream_invalid;
+        for (uint8_t i = 0; i < args[1]; ++i)
+            stream_set_hsv(&stream_palette[args[0] + i], &args[2 + i * 3]);
+        return vialrgb_stream_ok;
+    case vialrgb_stream_indexed:
+        if (length < 3 || ((size_t)args[2] + 1) / 2 > length - 3) return vialrgb_stream_invalid;
+        return stream_indexed(stream_frame(seq), args[0] | (args[1] << 8), args[2], &args[3]);
+    case vialrgb_stream_delta:
+        if (length < 2) return vialrgb_stream_invalid;
+        return stream_delta(stream_frame(seq), args[0] | (args[1] << 8), &args[2], length - 2);
+    case vialrgb_stream_commit:
+        return stream_commit(seq);
+    }
+    return vialrgb_stream_invalid;
+}
+
+void vialrgb_direct_frame_start(void) {
+    if (!stream_pending) return;
+    memcpy(g_direct_mode_colors, stream_frames[stream_back ^ 1], sizeof(g_direct_mode_colors));
+    stream_pending = false;
+    stream_shown_seq = stream_pending_seq;
+}
+#endif
+
 void vialrgb_get_value(uint8_t *data, uint8_t length) {
     if (length != VIAL_RAW_EPSIZE) return;
 
@@ -177,6 +288,15 @@ void vialrgb_set_value(uint8_t *data, uint8_t length) {
         fast_set_leds(args, length);
         break;
     }
+#endif
+#ifdef VIALRGB_DIRECT_STREAM
+    case vialrgb_direct_stream: {
+        uint8_t status = stream_packet(args, length - 2);
+        args[1] = status;
+        args[2] = stream_shown_seq;
+        args[3] = stream_dropped;
+        break;
+    }
 #endif
     }
 }
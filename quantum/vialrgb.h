@@ -11,8 +11,35 @@
 enum {
     vialrgb_set_mode = 0x41,
     vialrgb_direct_fastset = 0x42,
+    vialrgb_direct_stream = 0x43,
 };
 
+/* Streamed direct mode frames.
+ * Every vialrgb_direct_stream packet starts with the sequence number of the frame it belongs to
+ * and one of the formats below. A frame starts from the latest committed one, so it only needs
+ * to carry the LEDs that changed, and is shown from the next rendered frame once committed.
+ * The reply holds the status of the packet, the sequence number of the frame on display, and
+ * the number of committed frames that were replaced before they could be shown. */
+enum {
+    /* first LED (16 bit), number of LEDs, HSV of each LED */
+    vialrgb_stream_hsv = 0x00,
+    /* first palette entry, number of entries, HSV of each entry */
+    vialrgb_stream_palette = 0x01,
+    /* first LED (16 bit), number of LEDs, palette entry of each LED, two per byte, low nibble first */
+    vialrgb_stream_indexed = 0x02,
+    /* first LED (16 bit), then runs of: number of LEDs to leave unchanged, number of LEDs, HSV of each LED */
+    vialrgb_stream_delta = 0x03,
+    /* no arguments, shows the frame */
+    vialrgb_stream_commit = 0x04,
+};
+
+enum {
+    vialrgb_stream_ok = 0x00,
+    vialrgb_stream_invalid = 0x01,
+};
+
+#define VIALRGB_STREAM_PALETTE_SIZE 16
+
 enum {
     vialrgb_get_info = 0x40,
     vialrgb_get_mode = 0x41,
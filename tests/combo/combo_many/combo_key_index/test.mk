@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs the tests in the parent directory with the combo keycode index
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../many_combos.c
+
+SRC += $(dir $(TEST_PATH))test_combo_many.cpp
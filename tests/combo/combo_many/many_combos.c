@@ -0,0 +1,128 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+#include "quantum.h"
+
+/* Every pair of KC_A..KC_X is a combo, 276 combos in total. */
+
+// clang-format off
+const uint16_t PROGMEM many_combo_keys[][3] = {
+    {KC_A, KC_B, COMBO_END}, {KC_A, KC_C, COMBO_END}, {KC_A, KC_D, COMBO_END}, {KC_A, KC_E, COMBO_END}, {KC_A, KC_F, COMBO_END}, {KC_A, KC_G, COMBO_END},
+    {KC_A, KC_H, COMBO_END}, {KC_A, KC_I, COMBO_END}, {KC_A, KC_J, COMBO_END}, {KC_A, KC_K, COMBO_END}, {KC_A, KC_L, COMBO_END}, {KC_A, KC_M, COMBO_END},
+    {KC_A, KC_N, COMBO_END}, {KC_A, KC_O, COMBO_END}, {KC_A, KC_P, COMBO_END}, {KC_A, KC_Q, COMBO_END}, {KC_A, KC_R, COMBO_END}, {KC_A, KC_S, COMBO_END},
+    {KC_A, KC_T, COMBO_END}, {KC_A, KC_U, COMBO_END}, {KC_A, KC_V, COMBO_END}, {KC_A, KC_W, COMBO_END}, {KC_A, KC_X, COMBO_END}, {KC_B, KC_C, COMBO_END},
+    {KC_B, KC_D, COMBO_END}, {KC_B, KC_E, COMBO_END}, {KC_B, KC_F, COMBO_END}, {KC_B, KC_G, COMBO_END}, {KC_B, KC_H, COMBO_END}, {KC_B, KC_I, COMBO_END},
+    {KC_B, KC_J, COMBO_END}, {KC_B, KC_K, COMBO_END}, {KC_B, KC_L, COMBO_END}, {KC_B, KC_M, COMBO_END}, {KC_B, KC_N, COMBO_END}, {KC_B, KC_O, COMBO_END},
+    {KC_B, KC_P, COMBO_END}, {KC_B, KC_Q, COMBO_END}, {KC_B, KC_R, COMBO_END}, {KC_B, KC_S, COMBO_END}, {KC_B, KC_T, COMBO_END}, {KC_B, KC_U, COMBO_END},
+    {KC_B, KC_V, COMBO_END}, {KC_B, KC_W, COMBO_END}, {KC_B, KC_X, COMBO_END}, {KC_C, KC_D, COMBO_END}, {KC_C, KC_E, COMBO_END}, {KC_C, KC_F, COMBO_END},
+    {KC_C, KC_G, COMBO_END}, {KC_C, KC_H, COMBO_END}, {KC_C, KC_I, COMBO_END}, {KC_C, KC_J, COMBO_END}, {KC_C, KC_K, COMBO_END}, {KC_C, KC_L, COMBO_END},
+    {KC_C, KC_M, COMBO_END}, {KC_C, KC_N, COMBO_END}, {KC_C, KC_O, COMBO_END}, {KC_C, KC_P, COMBO_END}, {KC_C, KC_Q, COMBO_END}, {KC_C, KC_R, COMBO_END},
+    {KC_C, KC_S, COMBO_END}, {KC_C, KC_T, COMBO_END}, {KC_C, KC_U, COMBO_END}, {KC_C, KC_V, COMBO_END}, {KC_C, KC_W, COMBO_END}, {KC_C, KC_X, COMBO_END},
+    {KC_D, KC_E, COMBO_END}, {KC_D, KC_F, COMBO_END}, {KC_D, KC_G, COMBO_END}, {KC_D, KC_H, COMBO_END}, {KC_D, KC_I, COMBO_END}, {KC_D, KC_J, COMBO_END},
+    {KC_D, KC_K, COMBO_END}, {KC_D, KC_L, COMBO_END}, {KC_D, KC_M, COMBO_END}, {KC_D, KC_N, COMBO_END}, {KC_D, KC_O, COMBO_END}, {KC_D, KC_P, COMBO_END},
+    {KC_D, KC_Q, COMBO_END}, {KC_D, KC_R, COMBO_END}, {KC_D, KC_S, COMBO_END}, {KC_D, KC_T, COMBO_END}, {KC_D, KC_U, COMBO_END}, {KC_D, KC_V, COMBO_END},
+    {KC_D, KC_W, COMBO_END}, {KC_D, KC_X, COMBO_END}, {KC_E, KC_F, COMBO_END}, {KC_E, KC_G, COMBO_END}, {KC_E, KC_H, COMBO_END}, {KC_E, KC_I, COMBO_END},
+    {KC_E, KC_J, COMBO_END}, {KC_E, KC_K, COMBO_END}, {KC_E, KC_L, COMBO_END}, {KC_E, KC_M, COMBO_END}, {KC_E, KC_N, COMBO_END}, {KC_E, KC_O, COMBO_END},
+    {KC_E, KC_P, COMBO_END}, {KC_E, KC_Q, COMBO_END}, {KC_E, KC_R, COMBO_END}, {KC_E, KC_S, COMBO_END}, {KC_E, KC_T, COMBO_END}, {KC_E, KC_U, COMBO_END},
+    {KC_E, KC_V, COMBO_END}, {KC_E, KC_W, COMBO_END}, {KC_E, KC_X, COMBO_END}, {KC_F, KC_G, COMBO_END}, {KC_F, KC_H, COMBO_END}, {KC_F, KC_I, COMBO_END},
+    {KC_F, KC_J, COMBO_END}, {KC_F, KC_K, COMBO_END}, {KC_F, KC_L, COMBO_END}, {KC_F, KC_M, COMBO_END}, {KC_F, KC_N, COMBO_END}, {KC_F, KC_O, COMBO_END},
+    {KC_F, KC_P, COMBO_END}, {KC_F, KC_Q, COMBO_END}, {KC_F, KC_R, COMBO_END}, {KC_F, KC_S, COMBO_END}, {KC_F, KC_T, COMBO_END}, {KC_F, KC_U, COMBO_END},
+    {KC_F, KC_V, COMBO_END}, {KC_F, KC_W, COMBO_END}, {KC_F, KC_X, COMBO_END}, {KC_G, KC_H, COMBO_END}, {KC_G, KC_I, COMBO_END}, {KC_G, KC_J, COMBO_END},
+    {KC_G, KC_K, COMBO_END}, {KC_G, KC_L, COMBO_END}, {KC_G, KC_M, COMBO_END}, {KC_G, KC_N, COMBO_END}, {KC_G, KC_O, COMBO_END}, {KC_G, KC_P, COMBO_END},
+    {KC_G, KC_Q, COMBO_END}, {KC_G, KC_R, COMBO_END}, {KC_G, KC_S, COMBO_END}, {KC_G, KC_T, COMBO_END}, {KC_G, KC_U, COMBO_END}, {KC_G, KC_V, COMBO_END},
+    {KC_G, KC_W, COMBO_END}, {KC_G, KC_X, COMBO_END}, {KC_H, KC_I, COMBO_END}, {KC_H, KC_J, COMBO_END}, {KC_H, KC_K, COMBO_END}, {KC_H, KC_L, COMBO_END},
+    {KC_H, KC_M, COMBO_END}, {KC_H, KC_N, COMBO_END}, {KC_H, KC_O, COMBO_END}, {KC_H, KC_P, COMBO_END}, {KC_H, KC_Q, COMBO_END}, {KC_H, KC_R, COMBO_END},
+    {KC_H, KC_S, COMBO_END}, {KC_H, KC_T, COMBO_END}, {KC_H, KC_U, COMBO_END}, {KC_H, KC_V, COMBO_END}, {KC_H, KC_W, COMBO_END}, {KC_H, KC_X, COMBO_END},
+    {KC_I, KC_J, COMBO_END}, {KC_I, KC_K, COMBO_END}, {KC_I, KC_L, COMBO_END}, {KC_I, KC_M, COMBO_END}, {KC_I, KC_N, COMBO_END}, {KC_I, KC_O, COMBO_END},
+    {KC_I, KC_P, COMBO_END}, {KC_I, KC_Q, COMBO_END}, {KC_I, KC_R, COMBO_END}, {KC_I, KC_S, COMBO_END}, {KC_I, KC_T, COMBO_END}, {KC_I, KC_U, COMBO_END},
+    {KC_I, KC_V, COMBO_END}, {KC_I, KC_W, COMBO_END}, {KC_I, KC_X, COMBO_END}, {KC_J, KC_K, COMBO_END}, {KC_J, KC_L, COMBO_END}, {KC_J, KC_M, COMBO_END},
+    {KC_J, KC_N, COMBO_END}, {KC_J, KC_O, COMBO_END}, {KC_J, KC_P, COMBO_END}, {KC_J, KC_Q, COMBO_END}, {KC_J, KC_R, COMBO_END}, {KC_J, KC_S, COMBO_END},
+    {KC_J, KC_T, COMBO_END}, {KC_J, KC_U, COMBO_END}, {KC_J, KC_V, COMBO_END}, {KC_J, KC_W, COMBO_END}, {KC_J, KC_X, COMBO_END}, {KC_K, KC_L, COMBO_END},
+    {KC_K, KC_M, COMBO_END}, {KC_K, KC_N, COMBO_END}, {KC_K, KC_O, COMBO_END}, {KC_K, KC_P, COMBO_END}, {KC_K, KC_Q, COMBO_END}, {KC_K, KC_R, COMBO_END},
+    {KC_K, KC_S, COMBO_END}, {KC_K, KC_T, COMBO_END}, {KC_K, KC_U, COMBO_END}, {KC_K, KC_V, COMBO_END}, {KC_K, KC_W, COMBO_END}, {KC_K, KC_X, COMBO_END},
+    {KC_L, KC_M, COMBO_END}, {KC_L, KC_N, COMBO_END}, {KC_L, KC_O, COMBO_END}, {KC_L, KC_P, COMBO_END}, {KC_L, KC_Q, COMBO_END}, {KC_L, KC_R, COMBO_END},
+    {KC_L, KC_S, COMBO_END}, {KC_L, KC_T, COMBO_END}, {KC_L, KC_U, COMBO_END}, {KC_L, KC_V, COMBO_END}, {KC_L, KC_W, COMBO_END}, {KC_L, KC_X, COMBO_END},
+    {KC_M, KC_N, COMBO_END}, {KC_M, KC_O, COMBO_END}, {KC_M, KC_P, COMBO_END}, {KC_M, KC_Q, COMBO_END}, {KC_M, KC_R, COMBO_END}, {KC_M, KC_S, COMBO_END},
+    {KC_M, KC_T, COMBO_END}, {KC_M, KC_U, COMBO_END}, {KC_M, KC_V, COMBO_END}, {KC_M, KC_W, COMBO_END}, {KC_M, KC_X, COMBO_END}, {KC_N, KC_O, COMBO_END},
+    {KC_N, KC_P, COMBO_END}, {KC_N, KC_Q, COMBO_END}, {KC_N, KC_R, COMBO_END}, {KC_N, KC_S, COMBO_END}, {KC_N, KC_T, COMBO_END}, {KC_N, KC_U, COMBO_END},
+    {KC_N, KC_V, COMBO_END}, {KC_N, KC_W, COMBO_END}, {KC_N, KC_X, COMBO_END}, {KC_O, KC_P, COMBO_END}, {KC_O, KC_Q, COMBO_END}, {KC_O, KC_R, COMBO_END},
+    {KC_O, KC_S, COMBO_END}, {KC_O, KC_T, COMBO_END}, {KC_O, KC_U, COMBO_END}, {KC_O, KC_V, COMBO_END}, {KC_O, KC_W, COMBO_END}, {KC_O, KC_X, COMBO_END},
+    {KC_P, KC_Q, COMBO_END}, {KC_P, KC_R, COMBO_END}, {KC_P, KC_S, COMBO_END}, {KC_P, KC_T, COMBO_END}, {KC_P, KC_U, COMBO_END}, {KC_P, KC_V, COMBO_END},
+    {KC_P, KC_W, COMBO_END}, {KC_P, KC_X, COMBO_END}, {KC_Q, KC_R, COMBO_END}, {KC_Q, KC_S, COMBO_END}, {KC_Q, KC_T, COMBO_END}, {KC_Q, KC_U, COMBO_END},
+    {KC_Q, KC_V, COMBO_END}, {KC_Q, KC_W, COMBO_END}, {KC_Q, KC_X, COMBO_END}, {KC_R, KC_S, COMBO_END}, {KC_R, KC_T, COMBO_END}, {KC_R, KC_U, COMBO_END},
+    {KC_R, KC_V, COMBO_END}, {KC_R, KC_W, COMBO_END}, {KC_R, KC_X, COMBO_END}, {KC_S, KC_T, COMBO_END}, {KC_S, KC_U, COMBO_END}, {KC_S, KC_V, COMBO_END},
+    {KC_S, KC_W, COMBO_END}, {KC_S, KC_X, COMBO_END}, {KC_T, KC_U, COMBO_END}, {KC_T, KC_V, COMBO_END}, {KC_T, KC_W, COMBO_END}, {KC_T, KC_X, COMBO_END},
+    {KC_U, KC_V, COMBO_END}, {KC_U, KC_W, COMBO_END}, {KC_U, KC_X, COMBO_END}, {KC_V, KC_W, COMBO_END}, {KC_V, KC_X, COMBO_END}, {KC_W, KC_X, COMBO_END},
+};
+
+combo_t key_combos[] = {
+    COMBO(many_combo_keys[0], KC_1), COMBO(many_combo_keys[1], KC_2), COMBO(many_combo_keys[2], KC_3), COMBO(many_combo_keys[3], KC_4),
+    COMBO(many_combo_keys[4], KC_5), COMBO(many_combo_keys[5], KC_6), COMBO(many_combo_keys[6], KC_7), COMBO(many_combo_keys[7], KC_8),
+    COMBO(many_combo_keys[8], KC_9), COMBO(many_combo_keys[9], KC_0), COMBO(many_combo_keys[10], KC_F1), COMBO(many_combo_keys[11], KC_F2),
+    COMBO(many_combo_keys[12], KC_F3), COMBO(many_combo_keys[13], KC_F4), COMBO(many_combo_keys[14], KC_F5), COMBO(many_combo_keys[15], KC_F6),
+    COMBO(many_combo_keys[16], KC_F7), COMBO(many_combo_keys[17], KC_F8), COMBO(many_combo_keys[18], KC_F9), COMBO(many_combo_keys[19], KC_F10),
+    COMBO(many_combo_keys[20], KC_F11), COMBO(many_combo_keys[21], KC_F12), COMBO(many_combo_keys[22], KC_1), COMBO(many_combo_keys[23], KC_2),
+    COMBO(many_combo_keys[24], KC_3), COMBO(many_combo_keys[25], KC_4), COMBO(many_combo_keys[26], KC_5), COMBO(many_combo_keys[27], KC_6),
+    COMBO(many_combo_keys[28], KC_7), COMBO(many_combo_keys[29], KC_8), COMBO(many_combo_keys[30], KC_9), COMBO(many_combo_keys[31], KC_0),
+    COMBO(many_combo_keys[32], KC_F1), COMBO(many_combo_keys[33], KC_F2), COMBO(many_combo_keys[34], KC_F3), COMBO(many_combo_keys[35], KC_F4),
+    COMBO(many_combo_keys[36], KC_F5), COMBO(many_combo_keys[37], KC_F6), COMBO(many_combo_keys[38], KC_F7), COMBO(many_combo_keys[39], KC_F8),
+    COMBO(many_combo_keys[40], KC_F9), COMBO(many_combo_keys[41], KC_F10), COMBO(many_combo_keys[42], KC_F11), COMBO(many_combo_keys[43], KC_F12),
+    COMBO(many_combo_keys[44], KC_1), COMBO(many_combo_keys[45], KC_2), COMBO(many_combo_keys[46], KC_3), COMBO(many_combo_keys[47], KC_4),
+    COMBO(many_combo_keys[48], KC_5), COMBO(many_combo_keys[49], KC_6), COMBO(many_combo_keys[50], KC_7), COMBO(many_combo_keys[51], KC_8),
+    COMBO(many_combo_keys[52], KC_9), COMBO(many_combo_keys[53], KC_0), COMBO(many_combo_keys[54], KC_F1), COMBO(many_combo_keys[55], KC_F2),
+    COMBO(many_combo_keys[56], KC_F3), COMBO(many_combo_keys[57], KC_F4), COMBO(many_combo_keys[58], KC_F5), COMBO(many_combo_keys[59], KC_F6),
+    COMBO(many_combo_keys[60], KC_F7), COMBO(many_combo_keys[61], KC_F8), COMBO(many_combo_keys[62], KC_F9), COMBO(many_combo_keys[63], KC_F10),
+    COMBO(many_combo_keys[64], KC_F11), COMBO(many_combo_keys[65], KC_F12), COMBO(many_combo_keys[66], KC_1), COMBO(many_combo_keys[67], KC_2),
+    COMBO(many_combo_keys[68], KC_3), COMBO(many_combo_keys[69], KC_4), COMBO(many_combo_keys[70], KC_5), COMBO(many_combo_keys[71], KC_6),
+    COMBO(many_combo_keys[72], KC_7), COMBO(many_combo_keys[73], KC_8), COMBO(many_combo_keys[74], KC_9), COMBO(many_combo_keys[75], KC_0),
+    COMBO(many_combo_keys[76], KC_F1), COMBO(many_combo_keys[77], KC_F2), COMBO(many_combo_keys[78], KC_F3), COMBO(many_combo_keys[79], KC_F4),
+    COMBO(many_combo_keys[80], KC_F5), COMBO(many_combo_keys[81], KC_F6), COMBO(many_combo_keys[82], KC_F7), COMBO(many_combo_keys[83], KC_F8),
+    COMBO(many_combo_keys[84], KC_F9), COMBO(many_combo_keys[85], KC_F10), COMBO(many_combo_keys[86], KC_F11), COMBO(many_combo_keys[87], KC_F12),
+    COMBO(many_combo_keys[88], KC_1), COMBO(many_combo_keys[89], KC_2), COMBO(many_combo_keys[90], KC_3), COMBO(many_combo_keys[91], KC_4),
+    COMBO(many_combo_keys[92], KC_5), COMBO(many_combo_keys[93], KC_6), COMBO(many_combo_keys[94], KC_7), COMBO(many_combo_keys[95], KC_8),
+    COMBO(many_combo_keys[96], KC_9), COMBO(many_combo_keys[97], KC_0), COMBO(many_combo_keys[98], KC_F1), COMBO(many_combo_keys[99], KC_F2),
+    COMBO(many_combo_keys[100], KC_F3), COMBO(many_combo_keys[101], KC_F4), COMBO(many_combo_keys[102], KC_F5), COMBO(many_combo_keys[103], KC_F6),
+    COMBO(many_combo_keys[104], KC_F7), COMBO(many_combo_keys[105], KC_F8), COMBO(many_combo_keys[106], KC_F9), COMBO(many_combo_keys[107], KC_F10),
+    COMBO(many_combo_keys[108], KC_F11), COMBO(many_combo_keys[109], KC_F12), COMBO(many_combo_keys[110], KC_1), COMBO(many_combo_keys[111], KC_2),
+    COMBO(many_combo_keys[112], KC_3), COMBO(many_combo_keys[113], KC_4), COMBO(many_combo_keys[114], KC_5), COMBO(many_combo_keys[115], KC_6),
+    COMBO(many_combo_keys[116], KC_7), COMBO(many_combo_keys[117], KC_8), COMBO(many_combo_keys[118], KC_9), COMBO(many_combo_keys[119], KC_0),
+    COMBO(many_combo_keys[120], KC_F1), COMBO(many_combo_keys[121], KC_F2), COMBO(many_combo_keys[122], KC_F3), COMBO(many_combo_keys[123], KC_F4),
+    COMBO(many_combo_keys[124], KC_F5), COMBO(many_combo_keys[125], KC_F6), COMBO(many_combo_keys[126], KC_F7), COMBO(many_combo_keys[127], KC_F8),
+    COMBO(many_combo_keys[128], KC_F9), COMBO(many_combo_keys[129], KC_F10), COMBO(many_combo_keys[130], KC_F11), COMBO(many_combo_keys[131], KC_F12),
+    COMBO(many_combo_keys[132], KC_1), COMBO(many_combo_keys[133], KC_2), COMBO(many_combo_keys[134], KC_3), COMBO(many_combo_keys[135], KC_4),
+    COMBO(many_combo_keys[136], KC_5), COMBO(many_combo_keys[137], KC_6), COMBO(many_combo_keys[138], KC_7), COMBO(many_combo_keys[139], KC_8),
+    COMBO(many_combo_keys[140], KC_9), COMBO(many_combo_keys[141], KC_0), COMBO(many_combo_keys[142], KC_F1), COMBO(many_combo_keys[143], KC_F2),
+    COMBO(many_combo_keys[144], KC_F3), COMBO(many_combo_keys[145], KC_F4), COMBO(many_combo_keys[146], KC_F5), COMBO(many_combo_keys[147], KC_F6),
+    COMBO(many_combo_keys[148], KC_F7), COMBO(many_combo_keys[149], KC_F8), COMBO(many_combo_keys[150], KC_F9), COMBO(many_combo_keys[151], KC_F10),
+    COMBO(many_combo_keys[152], KC_F11), COMBO(many_combo_keys[153], KC_F12), COMBO(many_combo_keys[154], KC_1), COMBO(many_combo_keys[155], KC_2),
+    COMBO(many_combo_keys[156], KC_3), COMBO(many_combo_keys[157], KC_4), COMBO(many_combo_keys[158], KC_5), COMBO(many_combo_keys[159], KC_6),
+    COMBO(many_combo_keys[160], KC_7), COMBO(many_combo_keys[161], KC_8), COMBO(many_combo_keys[162], KC_9), COMBO(many_combo_keys[163], KC_0),
+    COMBO(many_combo_keys[164], KC_F1), COMBO(many_combo_keys[165], KC_F2), COMBO(many_combo_keys[166], KC_F3), COMBO(many_combo_keys[167], KC_F4),
+    COMBO(many_combo_keys[168], KC_F5), COMBO(many_combo_keys[169], KC_F6), COMBO(many_combo_keys[170], KC_F7), COMBO(many_combo_keys[171], KC_F8),
+    COMBO(many_combo_keys[172], KC_F9), COMBO(many_combo_keys[173], KC_F10), COMBO(many_combo_keys[174], KC_F11), COMBO(many_combo_keys[175], KC_F12),
+    COMBO(many_combo_keys[176], KC_1), COMBO(many_combo_keys[177], KC_2), COMBO(many_combo_keys[178], KC_3), COMBO(many_combo_keys[179], KC_4),
+    COMBO(many_combo_keys[180], KC_5), COMBO(many_combo_keys[181], KC_6), COMBO(many_combo_keys[182], KC_7), COMBO(many_combo_keys[183], KC_8),
+    COMBO(many_combo_keys[184], KC_9), COMBO(many_combo_keys[185], KC_0), COMBO(many_combo_keys[186], KC_F1), COMBO(many_combo_keys[187], KC_F2),
+    COMBO(many_combo_keys[188], KC_F3), COMBO(many_combo_keys[189], KC_F4), COMBO(many_combo_keys[190], KC_F5), COMBO(many_combo_keys[191], KC_F6),
+    COMBO(many_combo_keys[192], KC_F7), COMBO(many_combo_keys[193], KC_F8), COMBO(many_combo_keys[194], KC_F9), COMBO(many_combo_keys[195], KC_F10),
+    COMBO(many_combo_keys[196], KC_F11), COMBO(many_combo_keys[197], KC_F12), COMBO(many_combo_keys[198], KC_1), COMBO(many_combo_keys[199], KC_2),
+    COMBO(many_combo_keys[200], KC_3), COMBO(many_combo_keys[201], KC_4), COMBO(many_combo_keys[202], KC_5), COMBO(many_combo_keys[203], KC_6),
+    COMBO(many_combo_keys[204], KC_7), COMBO(many_combo_keys[205], KC_8), COMBO(many_combo_keys[206], KC_9), COMBO(many_combo_keys[207], KC_0),
+    COMBO(many_combo_keys[208], KC_F1), COMBO(many_combo_keys[209], KC_F2), COMBO(many_combo_keys[210], KC_F3), COMBO(many_combo_keys[211], KC_F4),
+    COMBO(many_combo_keys[212], KC_F5), COMBO(many_combo_keys[213], KC_F6), COMBO(many_combo_keys[214], KC_F7), COMBO(many_combo_keys[215], KC_F8),
+    COMBO(many_combo_keys[216], KC_F9), COMBO(many_combo_keys[217], KC_F10), COMBO(many_combo_keys[218], KC_F11), COMBO(many_combo_keys[219], KC_F12),
+    COMBO(many_combo_keys[220], KC_1), COMBO(many_combo_keys[221], KC_2), COMBO(many_combo_keys[222], KC_3), COMBO(many_combo_keys[223], KC_4),
+    COMBO(many_combo_keys[224], KC_5), COMBO(many_combo_keys[225], KC_6), COMBO(many_combo_keys[226], KC_7), COMBO(many_combo_keys[227], KC_8),
+    COMBO(many_combo_keys[228], KC_9), COMBO(many_combo_keys[229], KC_0), COMBO(many_combo_keys[230], KC_F1), COMBO(many_combo_keys[231], KC_F2),
+    COMBO(many_combo_keys[232], KC_F3), COMBO(many_combo_keys[233], KC_F4), COMBO(many_combo_keys[234], KC_F5), COMBO(many_combo_keys[235], KC_F6),
+    COMBO(many_combo_keys[236], KC_F7), COMBO(many_combo_keys[237], KC_F8), COMBO(many_combo_keys[238], KC_F9), COMBO(many_combo_keys[239], KC_F10),
+    COMBO(many_combo_keys[240], KC_F11), COMBO(many_combo_keys[241], KC_F12), COMBO(many_combo_keys[242], KC_1), COMBO(many_combo_keys[243], KC_2),
+    COMBO(many_combo_keys[244], KC_3), COMBO(many_combo_keys[245], KC_4), COMBO(many_combo_keys[246], KC_5), COMBO(many_combo_keys[247], KC_6),
+    COMBO(many_combo_keys[248], KC_7), COMBO(many_combo_keys[249], KC_8), COMBO(many_combo_keys[250], KC_9), COMBO(many_combo_keys[251], KC_0),
+    COMBO(many_combo_keys[252], KC_F1), COMBO(many_combo_keys[253], KC_F2), COMBO(many_combo_keys[254], KC_F3), COMBO(many_combo_keys[255], KC_F4),
+    COMBO(many_combo_keys[256], KC_F5), COMBO(many_combo_keys[257], KC_F6), COMBO(many_combo_keys[258], KC_F7), COMBO(many_combo_keys[259], KC_F8),
+    COMBO(many_combo_keys[260], KC_F9), COMBO(many_combo_keys[261], KC_F10), COMBO(many_combo_keys[262], KC_F11), COMBO(many_combo_keys[263], KC_F12),
+    COMBO(many_combo_keys[264], KC_1), COMBO(many_combo_keys[265], KC_2), COMBO(many_combo_keys[266], KC_3), COMBO(many_combo_keys[267], KC_4),
+    COMBO(many_combo_keys[268], KC_5), COMBO(many_combo_keys[269], KC_6), COMBO(many_combo_keys[270], KC_7), COMBO(many_combo_keys[271], KC_8),
+    COMBO(many_combo_keys[272], KC_9), COMBO(many_combo_keys[273], KC_0), COMBO(many_combo_keys[274], KC_F1), COMBO(many_combo_keys[275], KC_F2),
+};
+// clang-format on
@@ -0,0 +1,131 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <vector>
+#include "keyboard_report_util.hpp"
+#include "quantum.h"
+#include "keycode.h"
+#include "test_common.h"
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::InSequence;
+
+extern "C" {
+extern combo_t key_combos[];
+uint16_t       combo_count(void);
+}
+
+/* The combos span KC_A..KC_X, which are laid out over the test matrix in order. KC_Y is not part
+ * of any combo. The same tests run with and without COMBO_KEY_INDEX, so they have to behave
+ * identically in both configurations. */
+class ComboMany : public TestFixture {
+   protected:
+    std::vector<KeymapKey> keys;
+
+    ComboMany() {
+        for (uint8_t i = 0; i < 25; i++) {
+            keys.emplace_back(0, i % MATRIX_COLS, i / MATRIX_COLS, KC_A + i);
+        }
+        for (auto &key : keys) {
+            add_key(key);
+        }
+    }
+
+    KeymapKey &key_for(uint16_t keycode) {
+        return keys[keycode - KC_A];
+    }
+};
+
+TEST_F(ComboMany, every_combo_fires) {
+    TestDriver driver;
+
+    for (uint16_t i = 0; i < combo_count(); i++) {
+        const combo_t *combo = &key_combos[i];
+        EXPECT_REPORT(driver, (combo->keycode));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_combo({key_for(combo->keys[0]), key_for(combo->keys[1])});
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(ComboMany, every_combo_fires_in_reverse_order) {
+    TestDriver driver;
+
+    for (uint16_t i = 0; i < combo_count(); i++) {
+        const combo_t *combo = &key_combos[i];
+        EXPECT_REPORT(driver, (combo->keycode));
+        EXPECT_EMPTY_REPORT(driver);
+        tap_combo({key_for(combo->keys[1]), key_for(combo->keys[0])});
+        VERIFY_AND_CLEAR(driver);
+    }
+}
+
+TEST_F(ComboMany, combo_key_tapped_alone) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_M));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_for(KC_M));
+    idle_for(COMBO_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboMany, combo_keys_pressed_too_slowly) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_C));
+    EXPECT_REPORT(driver, (KC_C, KC_D));
+    EXPECT_REPORT(driver, (KC_D));
+    EXPECT_EMPTY_REPORT(driver);
+    /* The combo timer treats a zero timestamp as stopped. */
+    run_one_scan_loop();
+    key_for(KC_C).press();
+    idle_for(COMBO_TERM + 1);
+    key_for(KC_D).press();
+    idle_for(COMBO_TERM + 1);
+    key_for(KC_C).release();
+    run_one_scan_loop();
+    key_for(KC_D).release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(ComboMany, non_combo_key_passes_through) {
+    TestDriver driver;
+    InSequence s;
+
+    EXPECT_REPORT(driver, (KC_Y));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_for(KC_Y));
+    VERIFY_AND_CLEAR(driver);
+}
+
+/* Reports the per key event cost of the scan loop with many combos defined. */
+TEST_F(ComboMany, benchmark) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    const uint16_t rounds = 4;
+    uint32_t       events = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (uint16_t round = 0; round < rounds; round++) {
+        for (uint16_t i = 0; i < combo_count(); i++) {
+            const combo_t *combo = &key_combos[i];
+            tap_combo({key_for(combo->keys[0]), key_for(combo->keys[1])});
+            events += 4;
+        }
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    VERIFY_AND_CLEAR(driver);
+
+    printf("%u combos: %.0f ns per key event\n", combo_count(), std::chrono::duration<double, std::nano>(elapsed).count() / events);
+}
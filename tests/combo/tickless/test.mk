@@ -0,0 +1,10 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs the tests in the parent directory with tick events suppressed while idle
+
+COMBO_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = ../test_combos.c
+
+SRC += $(dir $(TEST_PATH))test_combo.cpp
@@ -0,0 +1,153 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class KeyLatency : public TestFixture {
+   protected:
+    KeyLatency() {
+        key_latency_reset();
+    }
+
+    const key_latency_histogram_t &stage(key_latency_stage_t stage) {
+        return *key_latency_get_histogram(stage);
+    }
+};
+
+TEST_F(KeyLatency, plain_tap_is_reported_in_the_same_scan) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 2);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).max, 0);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).buckets[0], 2);
+    EXPECT_EQ(key_latency_get_dropped(), 0);
+}
+
+TEST_F(KeyLatency, mod_tap_tap_is_buffered_until_release) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.press();
+    idle_for(50);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    /* The press and release fold into one sample, ended by the first report. */
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 1);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).min, 50000);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).buckets[KEY_LATENCY_BUCKETS - 1], 1);
+    EXPECT_EQ(stage(KEY_LATENCY_PROCESS).max, 0);
+    EXPECT_EQ(stage(KEY_LATENCY_BUFFER).max, 50000);
+}
+
+TEST_F(KeyLatency, change_without_report_is_replaced) {
+    TestDriver driver;
+    auto       layer_key   = KeymapKey(0, 0, 0, MO(1));
+    auto       regular_key = KeymapKey(0, 1, 0, KC_A);
+    set_keymap({layer_key, regular_key, KeymapKey(1, 1, 0, KC_B)});
+
+    EXPECT_NO_REPORT(driver);
+    layer_key.press();
+    idle_for(30);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    regular_key.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 1);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).max, 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    regular_key.release();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, change_buffered_past_timeout_is_dropped) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 0, 0, LSFT_T(KC_A));
+    set_keymap({mod_tap_key});
+
+    EXPECT_REPORT(driver, (KC_LSFT));
+    mod_tap_key.press();
+    idle_for(TAPPING_TERM + 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 0);
+    EXPECT_EQ(key_latency_get_dropped(), 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    mod_tap_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 1);
+}
+
+TEST_F(KeyLatency, debounce_stage_is_measured_from_the_raw_change) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+
+    /* The test matrix has no debounce, so emulate the scans of one that does. */
+    key_latency_debounce_task(false, false);
+    idle_for(5);
+    key.press();
+    key_latency_debounce_task(true, true);
+
+    EXPECT_REPORT(driver, (KC_A));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).max, 5000);
+    EXPECT_EQ(stage(KEY_LATENCY_DEBOUNCE).max, 5000);
+    EXPECT_EQ(stage(KEY_LATENCY_BUFFER).max, 0);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).buckets[5000 / KEY_LATENCY_BUCKET_WIDTH], 1);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyLatency, reset_clears_histograms) {
+    TestDriver driver;
+    auto       key = KeymapKey(0, 0, 0, KC_A);
+    set_keymap({key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    tap_key(key);
+    EXPECT_EQ(stage(KEY_LATENCY_TOTAL).count, 2);
+
+    key_latency_reset();
+    for (uint8_t i = 0; i < KEY_LATENCY_STAGE_COUNT; i++) {
+        const key_latency_histogram_t *histogram = key_latency_get_histogram((key_latency_stage_t)i);
+        EXPECT_EQ(histogram->count, 0);
+        EXPECT_EQ(histogram->sum, 0);
+        EXPECT_EQ(histogram->buckets[0], 0);
+    }
+    EXPECT_EQ(key_latency_get_histogram(KEY_LATENCY_STAGE_COUNT), nullptr);
+    VERIFY_AND_CLEAR(driver);
+}
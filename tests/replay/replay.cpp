@@ -0,0 +1,118 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "replay.hpp"
+#include <chrono>
+#include <ctime>
+#include <fstream>
+#include <sstream>
+
+#include "action.h"
+#include "action_tapping.h"
+#include "test_matrix.h"
+#include "timer.h"
+
+using testing::_;
+using testing::AnyNumber;
+using testing::Invoke;
+
+namespace {
+enum : uint8_t {
+    REPORT_KEYBOARD = 1,
+    REPORT_NKRO,
+    REPORT_MOUSE,
+    REPORT_EXTRA,
+};
+} // namespace
+
+std::string load_replay_trace(const std::string& path, std::vector<ReplayEvent>& events) {
+    std::ifstream file(path);
+    if (!file) {
+        return "cannot open " + path;
+    }
+
+    std::string line;
+    unsigned    line_number = 0;
+    while (std::getline(file, line)) {
+        line_number++;
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        std::istringstream fields(line);
+        uint32_t           time;
+        unsigned           row, col;
+        char               action;
+        if (!(fields >> time >> row >> col >> action) || (action != 'd' && action != 'u')) {
+            return path + ":" + std::to_string(line_number) + ": expected '<time> <row> <col> <d|u>'";
+        }
+        if (row >= MATRIX_ROWS || col >= MATRIX_COLS) {
+            return path + ":" + std::to_string(line_number) + ": key is outside of the matrix";
+        }
+        if (!events.empty() && time < events.back().time) {
+            return path + ":" + std::to_string(line_number) + ": events are not ordered by time";
+        }
+        events.push_back({time, static_cast<uint8_t>(row), static_cast<uint8_t>(col), action == 'd'});
+    }
+    return "";
+}
+
+ReportRecorder::ReportRecorder(TestDriver& driver) : m_start(timer_read32()) {
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_keyboard_t& report) {
+        record(REPORT_KEYBOARD, &report, sizeof(report));
+    }));
+    EXPECT_CALL(driver, send_nkro_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_nkro_t& report) {
+        record(REPORT_NKRO, &report, sizeof(report));
+    }));
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_mouse_t& report) {
+        record(REPORT_MOUSE, &report, sizeof(report));
+    }));
+    EXPECT_CALL(driver, send_extra_mock(_)).Times(AnyNumber()).WillRepeatedly(Invoke([this](report_extra_t& report) {
+        record(REPORT_EXTRA, &report, sizeof(report));
+    }));
+}
+
+void ReportRecorder::record(uint8_t type, const void* report, size_t size) {
+    uint32_t elapsed   = timer_read32() - m_start;
+    uint8_t  header[5] = {type, static_cast<uint8_t>(elapsed), static_cast<uint8_t>(elapsed >> 8), static_cast<uint8_t>(elapsed >> 16), static_cast<uint8_t>(elapsed >> 24)};
+
+    auto fold = [this](const uint8_t* data, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            m_hash ^= data[i];
+            m_hash *= 1099511628211ULL;
+        }
+    };
+    fold(header, sizeof(header));
+    fold(static_cast<const uint8_t*>(report), size);
+    m_count++;
+}
+
+ReplayStats replay_trace(TestFixture& fixture, const std::vector<ReplayEvent>& events) {
+    ReplayStats stats = {static_cast<uint32_t>(events.size()), 0, 0, 0};
+    uint32_t    now   = 0;
+
+    std::clock_t cpu_start  = std::clock();
+    auto         wall_start = std::chrono::steady_clock::now();
+
+    for (size_t i = 0; i < events.size();) {
+        if (events[i].time > now) {
+            fixture.idle_for(events[i].time - now);
+            stats.scans += events[i].time - now;
+            now = events[i].time;
+        }
+        // Every change sharing a timestamp is seen by the same scan
+        for (; i < events.size() && events[i].time == now; i++) {
+            if (events[i].pressed) {
+                press_key(events[i].col, events[i].row);
+            } else {
+                release_key(events[i].col, events[i].row);
+            }
+        }
+    }
+    fixture.idle_for(TAPPING_TERM);
+    stats.scans += TAPPING_TERM;
+
+    stats.cpu_seconds  = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+    stats.wall_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wall_start).count();
+    return stats;
+}
@@ -0,0 +1,64 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "test_driver.hpp"
+#include "test_fixture.hpp"
+
+/**
+ * @brief A single key change of a recorded trace.
+ */
+struct ReplayEvent {
+    uint32_t time; // milliseconds since the start of the trace
+    uint8_t  row;
+    uint8_t  col;
+    bool     pressed;
+};
+
+/**
+ * @brief Loads a trace file with one `<time> <row> <col> <d|u>` event per line.
+ * Empty lines and lines starting with `#` are skipped. Events must be ordered by time.
+ *
+ * @return An empty string on success, otherwise a description of the first error.
+ */
+std::string load_replay_trace(const std::string& path, std::vector<ReplayEvent>& events);
+
+/**
+ * @brief Accepts every report sent to `driver` and folds it, together with the time it
+ * was sent at, into a FNV-1a hash.
+ */
+class ReportRecorder {
+   public:
+    explicit ReportRecorder(TestDriver& driver);
+
+    uint64_t hash() const {
+        return m_hash;
+    }
+    uint32_t count() const {
+        return m_count;
+    }
+
+   private:
+    void record(uint8_t type, const void* report, size_t size);
+
+    uint32_t m_start;
+    uint64_t m_hash  = 14695981039346656037ULL;
+    uint32_t m_count = 0;
+};
+
+struct ReplayStats {
+    uint32_t events;
+    uint32_t scans;
+    double   cpu_seconds;
+    double   wall_seconds;
+};
+
+/**
+ * @brief Replays `events` through the fixture's scan loop, running one keyboard_task()
+ * per millisecond of trace time, and measures the time spent doing so.
+ */
+ReplayStats replay_trace(TestFixture& fixture, const std::vector<ReplayEvent>& events);
@@ -0,0 +1,108 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include "keyboard_report_util.hpp"
+#include "replay.hpp"
+#include "test_common.hpp"
+
+using testing::InSequence;
+
+// Hash of the reports sent while replaying traces/typing.trace. Update it together with any
+// intended change in behavior, after checking the difference in the test log.
+#define TYPING_TRACE_HASH 0xa3c6c7d48b6a67f9ULL
+
+class Replay : public TestFixture {
+   public:
+    void SetUp() override {
+        // clang-format off
+        static const uint16_t base[MATRIX_ROWS][MATRIX_COLS] = {
+            {KC_Q,         KC_W,    KC_E,    KC_R,    KC_T,           KC_Y,    KC_U,    KC_I,    KC_O,    KC_P},
+            {KC_A,         KC_S,    KC_D,    KC_F,    KC_G,           KC_H,    KC_J,    KC_K,    KC_L,    KC_BSPC},
+            {LCTL_T(KC_Z), KC_X,    KC_C,    KC_V,    KC_B,           KC_N,    KC_M,    KC_COMM, KC_DOT,  KC_QUOT},
+            {KC_LSFT,      CW_TOGG, KC_LGUI, KC_LALT, LT(1, KC_SPC),  KC_TAB,  KC_ENT,  KC_MINS, KC_SLSH, KC_RSFT},
+        };
+        static const uint16_t numbers[MATRIX_COLS] = {KC_1, KC_2, KC_3, KC_4, KC_5, KC_6, KC_7, KC_8, KC_9, KC_0};
+        // clang-format on
+
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                add_key(KeymapKey(0, col, row, base[row][col]));
+                add_key(KeymapKey(1, col, row, row == 0 ? numbers[col] : KC_TRNS));
+            }
+        }
+    }
+};
+
+static std::string typing_trace_path() {
+    std::string file(__FILE__);
+    return file.substr(0, file.find_last_of('/') + 1) + "traces/typing.trace";
+}
+
+TEST_F(Replay, ShortTraceSendsReportsInOrder) {
+    TestDriver driver;
+    InSequence s;
+
+    std::vector<ReplayEvent> events = {
+        {0, 1, 0, true},   /* A down */
+        {40, 1, 1, true},  /* S down, rolling over A */
+        {60, 1, 0, false}, /* A up */
+        {90, 1, 1, false}, /* S up */
+    };
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_REPORT(driver, (KC_A, KC_S));
+    EXPECT_REPORT(driver, (KC_S));
+    EXPECT_EMPTY_REPORT(driver);
+    ReplayStats stats = replay_trace(*this, events);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(stats.events, 4);
+    EXPECT_EQ(stats.scans, 90 + TAPPING_TERM);
+}
+
+TEST_F(Replay, MalformedTraceIsRejected) {
+    std::string path = testing::TempDir() + "replay_malformed.trace";
+    {
+        std::ofstream file(path);
+        file << "# comment\n\n0 1 0 d\n10 1 0 x\n";
+    }
+
+    std::vector<ReplayEvent> events;
+    EXPECT_EQ(load_replay_trace(path, events), path + ":4: expected '<time> <row> <col> <d|u>'");
+    EXPECT_EQ(events.size(), 1);
+    std::remove(path.c_str());
+
+    events.clear();
+    EXPECT_NE(load_replay_trace(path, events), "");
+}
+
+/*
+ * Replays a recorded typing session, or the trace named by the REPLAY_TRACE environment
+ * variable, and reports the throughput of the key processing pipeline.
+ */
+TEST_F(Replay, TypingTrace) {
+    TestDriver     driver;
+    ReportRecorder recorder(driver);
+
+    const char*              custom_trace = std::getenv("REPLAY_TRACE");
+    std::string              path         = custom_trace ? custom_trace : typing_trace_path();
+    std::vector<ReplayEvent> events;
+    std::string              error = load_replay_trace(path, events);
+    ASSERT_EQ(error, "");
+    ASSERT_FALSE(events.empty());
+
+    ReplayStats stats = replay_trace(*this, events);
+
+    std::printf("replay: %s\n", path.c_str());
+    std::printf("replay: %u events, %u scans, %u reports, hash 0x%016llx\n", stats.events, stats.scans, recorder.count(), (unsigned long long)recorder.hash());
+    std::printf("replay: %.3f s cpu, %.3f s wall, %.0f events/s, %.0f ns/event, %.0f ns/scan\n", stats.cpu_seconds, stats.wall_seconds, stats.events / stats.cpu_seconds, stats.cpu_seconds * 1e9 / stats.events, stats.cpu_seconds * 1e9 / stats.scans);
+    RecordProperty("events", stats.events);
+    RecordProperty("ns_per_event", static_cast<int>(stats.cpu_seconds * 1e9 / stats.events));
+
+    if (!custom_trace) {
+        EXPECT_EQ(recorder.hash(), TYPING_TRACE_HASH) << "reports sent for " << path << " changed";
+    }
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+enum combos { jk_escape };
+
+uint16_t const jk_combo[] = {KC_J, KC_K, COMBO_END};
+
+// clang-format off
+combo_t key_combos[] = {
+    [jk_escape] = COMBO(jk_combo, KC_ESCAPE)
+};
+// clang-format on
+
+const key_override_t delete_key_override = ko_make_basic(MOD_MASK_SHIFT, KC_BACKSPACE, KC_DELETE);
+
+const key_override_t **key_overrides = (const key_override_t *[]){
+    &delete_key_override,
+    NULL,
+};
@@ -0,0 +1,8 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# The LED driver and layouts shared by the rgb_matrix tests, included from their test.mk
+
+VPATH += $(TOP_DIR)/tests/rgb_matrix/common
+
+SRC += tests/rgb_matrix/common/test_rgb_matrix_driver.cpp
@@ -0,0 +1,117 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_rgb_matrix_driver.hpp"
+
+RGB test_rgb_matrix_leds[RGB_MATRIX_LED_COUNT];
+
+void (*test_rgb_matrix_flush_hook)(void) = nullptr;
+
+// clang-format off
+const TestRgbMatrixLayout test_rgb_matrix_layouts[TEST_RGB_MATRIX_LAYOUT_COUNT] = {
+    // One LED per key, spread over the whole 224x64 area
+    {"grid", {{
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 10, 11, 12, 13, 14, 15, 16, 17, 18, 19 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 },
+    }, {
+        {  0,  0 }, { 24,  0 }, { 49,  0 }, { 74,  0 }, { 99,  0 }, {124,  0 }, {149,  0 }, {174,  0 }, {199,  0 }, {224,  0 },
+        {  0, 21 }, { 24, 21 }, { 49, 21 }, { 74, 21 }, { 99, 21 }, {124, 21 }, {149, 21 }, {174, 21 }, {199, 21 }, {224, 21 },
+        {  0, 42 }, { 24, 42 }, { 49, 42 }, { 74, 42 }, { 99, 42 }, {124, 42 }, {149, 42 }, {174, 42 }, {199, 42 }, {224, 42 },
+        {  0, 64 }, { 24, 64 }, { 49, 64 }, { 74, 64 }, { 99, 64 }, {124, 64 }, {149, 64 }, {174, 64 }, {199, 64 }, {224, 64 },
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 4, 4, 4, 4, 4, 4, 1, 1,
+    }}},
+    // Row staggered, with the LEDs wired in a serpentine
+    {"staggered", {{
+        {  0,  1,  2,  3,  4,  5,  6,  7,  8,  9 },
+        { 19, 18, 17, 16, 15, 14, 13, 12, 11, 10 },
+        { 20, 21, 22, 23, 24, 25, 26, 27, 28, 29 },
+        { 39, 38, 37, 36, 35, 34, 33, 32, 31, 30 },
+    }, {
+        {  0,  0 }, { 22,  0 }, { 44,  0 }, { 66,  0 }, { 88,  0 }, {110,  0 }, {132,  0 }, {154,  0 }, {176,  0 }, {198,  0 },
+        {204, 21 }, {182, 21 }, {160, 21 }, {138, 21 }, {116, 21 }, { 94, 21 }, { 72, 21 }, { 50, 21 }, { 28, 21 }, {  6, 21 },
+        {  9, 42 }, { 31, 42 }, { 53, 42 }, { 75, 42 }, { 97, 42 }, {119, 42 }, {141, 42 }, {163, 42 }, {185, 42 }, {207, 42 },
+        {224, 64 }, {202, 64 }, {180, 64 }, {158, 64 }, {136, 64 }, {114, 64 }, { 92, 64 }, { 70, 64 }, { 48, 64 }, { 15, 64 },
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 4, 4, 4, 4, 4, 4, 1, 1,
+    }}},
+    // Two blocks with a gap in between, the right one wired from its own first LED. A single board,
+    // RGB_MATRIX_SPLIT needs a split keyboard build and isn't covered here.
+    {"gapped", {{
+        {  0,  1,  2,  3,  4, 20, 21, 22, 23, 24 },
+        {  5,  6,  7,  8,  9, 25, 26, 27, 28, 29 },
+        { 10, 11, 12, 13, 14, 30, 31, 32, 33, 34 },
+        { 15, 16, 17, 18, 19, 35, 36, 37, 38, 39 },
+    }, {
+        {  0,  4 }, { 20,  0 }, { 40,  0 }, { 60,  2 }, { 80,  6 },
+        {  0, 24 }, { 20, 20 }, { 40, 20 }, { 60, 22 }, { 80, 26 },
+        {  0, 44 }, { 20, 40 }, { 40, 40 }, { 60, 42 }, { 80, 46 },
+        { 30, 64 }, { 50, 64 }, { 70, 64 }, { 88, 60 }, {100, 56 },
+        {144,  6 }, {164,  2 }, {184,  0 }, {204,  0 }, {224,  4 },
+        {144, 26 }, {164, 22 }, {184, 20 }, {204, 20 }, {224, 24 },
+        {144, 46 }, {164, 42 }, {184, 40 }, {204, 40 }, {224, 44 },
+        {124, 56 }, {136, 60 }, {154, 64 }, {174, 64 }, {194, 64 },
+    }, {
+        4, 4, 4, 4, 4,  4, 4, 4, 4, 4,  4, 4, 4, 4, 4,  1, 1, 1, 4, 4,
+        4, 4, 4, 4, 4,  4, 4, 4, 4, 4,  4, 4, 4, 4, 4,  4, 4, 1, 1, 1,
+    }}},
+    // Keys on the first eight columns and underglow around the edges
+    {"underglow", {{
+        {  0,  1,  2,  3,  4,  5,  6,  7, NO_LED, NO_LED },
+        {  8,  9, 10, 11, 12, 13, 14, 15, NO_LED, NO_LED },
+        { 16, 17, 18, 19, 20, 21, 22, 23, NO_LED, NO_LED },
+        { 24, 25, 26, 27, 28, 29, 30, 31, NO_LED, NO_LED },
+    }, {
+        { 16,  8 }, { 42,  8 }, { 68,  8 }, { 94,  8 }, {120,  8 }, {146,  8 }, {172,  8 }, {198,  8 },
+        { 16, 24 }, { 42, 24 }, { 68, 24 }, { 94, 24 }, {120, 24 }, {146, 24 }, {172, 24 }, {198, 24 },
+        { 16, 40 }, { 42, 40 }, { 68, 40 }, { 94, 40 }, {120, 40 }, {146, 40 }, {172, 40 }, {198, 40 },
+        { 16, 56 }, { 42, 56 }, { 68, 56 }, { 94, 56 }, {120, 56 }, {146, 56 }, {172, 56 }, {198, 56 },
+        {224, 64 }, {112, 64 }, {  0, 64 }, {  0, 32 }, {  0,  0 }, {112,  0 }, {224,  0 }, {224, 32 },
+    }, {
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        4, 4, 4, 4, 4, 4, 4, 4,
+        1, 1, 1, 4, 4, 4, 1, 1,
+        2, 2, 2, 2, 2, 2, 2, 2,
+    }}},
+};
+// clang-format on
+
+namespace {
+void init(void) {}
+
+void set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    test_rgb_matrix_leds[index] = {r, g, b};
+}
+
+void set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        set_color(i, r, g, b);
+    }
+}
+
+void flush(void) {
+    if (test_rgb_matrix_flush_hook) {
+        test_rgb_matrix_flush_hook();
+    }
+}
+} // namespace
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {
+    .init          = init,
+    .set_color     = set_color,
+    .set_color_all = set_color_all,
+    .flush         = flush,
+};
+
+led_config_t g_led_config = test_rgb_matrix_layouts[0].config;
+}
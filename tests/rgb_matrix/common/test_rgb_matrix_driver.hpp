@@ -0,0 +1,24 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+extern "C" {
+#include "rgb_matrix.h"
+}
+
+#define TEST_RGB_MATRIX_LAYOUT_COUNT 4
+
+struct TestRgbMatrixLayout {
+    const char*  name;
+    led_config_t config;
+};
+
+// The colors last sent to the driver, one per LED
+extern RGB test_rgb_matrix_leds[RGB_MATRIX_LED_COUNT];
+
+// Called on every flush of the driver when set
+extern void (*test_rgb_matrix_flush_hook)(void);
+
+// The layouts the tests render on. g_led_config starts as the first one, the "grid".
+extern const TestRgbMatrixLayout test_rgb_matrix_layouts[TEST_RGB_MATRIX_LAYOUT_COUNT];
@@ -0,0 +1,11 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Renders every effect, along with the VialRGB direct mode, against the golden frames in golden/
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+include tests/rgb_matrix/common/build.mk
+
+SRC += $(QUANTUM_PATH)/vialrgb.c
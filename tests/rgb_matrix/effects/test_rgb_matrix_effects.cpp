@@ -0,0 +1,195 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.hpp"
+
+extern "C" {
+#include "lib/lib8tion/lib8tion.h"
+
+extern HSV g_direct_mode_colors[RGB_MATRIX_LED_COUNT];
+
+void advance_time(uint32_t ms);
+}
+
+// Frames compared against the golden files, then rendered on to measure the time per frame
+#define GOLDEN_FRAME_COUNT 48
+#define TIMED_FRAME_COUNT 400
+
+// Set to regenerate the golden files after an intended change to the output of an effect
+#define UPDATE_GOLDEN_ENV "RGB_MATRIX_UPDATE_GOLDEN"
+
+namespace {
+// FNV-1a of the colors sent to the driver
+uint32_t frame_hash(void) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(test_rgb_matrix_leds);
+    uint32_t       hash = 2166136261U;
+    for (size_t i = 0; i < sizeof(test_rgb_matrix_leds); i++) {
+        hash ^= data[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+} // namespace
+
+struct Effect {
+    uint8_t     mode;
+    const char* name;
+};
+
+static const Effect effects[] = {
+#define RGB_MATRIX_EFFECT(name, ...) {RGB_MATRIX_##name, #name},
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+// Effects using rand(), whose sequence depends on the C library, are only compared with glibc
+static bool uses_libc_rand(uint8_t mode) {
+    switch (mode) {
+        case RGB_MATRIX_DIGITAL_RAIN:
+        case RGB_MATRIX_STARLIGHT:
+        case RGB_MATRIX_STARLIGHT_DUAL_HUE:
+        case RGB_MATRIX_STARLIGHT_DUAL_SAT:
+            return true;
+        default:
+            return false;
+    }
+}
+
+#ifdef __GLIBC__
+static const bool compare_libc_rand = true;
+#else
+static const bool compare_libc_rand = false;
+#endif
+
+class RgbMatrixEffects : public TestFixture {
+   protected:
+    // The key pressed in some frames, so that the reactive effects have something to show
+    static void press_keys(int frame) {
+        static const keypos_t keys[] = {{.col = 2, .row = 1}, {.col = 6, .row = 2}, {.col = 4, .row = 0}};
+        const keypos_t&       key    = keys[(frame / 12) % 3];
+        if (frame % 12 == 2) {
+            rgb_matrix_handle_key_event(key.row, key.col, true);
+        } else if (frame % 12 == 5) {
+            rgb_matrix_handle_key_event(key.row, key.col, false);
+        }
+    }
+
+    // Syncs, renders and flushes one frame, returning the time spent in rgb_matrix_task()
+    static std::chrono::nanoseconds render_frame(int frame) {
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            g_direct_mode_colors[i] = {static_cast<uint8_t>(i * 6 + frame), 255, static_cast<uint8_t>(128 + i)};
+        }
+        press_keys(frame);
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+
+        auto start = std::chrono::steady_clock::now();
+        while (true) {
+            rgb_matrix_task();
+            if (rgb_matrix_time_until_next() > 0) {
+                break;
+            }
+        }
+        return std::chrono::steady_clock::now() - start;
+    }
+
+    static std::string golden_path(const TestRgbMatrixLayout& layout) {
+        std::string file = __FILE__;
+        return file.substr(0, file.find_last_of('/') + 1) + "golden/" + layout.name + ".txt";
+    }
+
+    // One line per effect: its name, followed by the hash of each frame
+    static std::map<std::string, std::vector<uint32_t>> read_golden(const TestRgbMatrixLayout& layout) {
+        std::map<std::string, std::vector<uint32_t>> golden;
+        std::ifstream                                file(golden_path(layout));
+        std::string                                  line;
+        while (std::getline(file, line)) {
+            std::istringstream    fields(line);
+            std::string           name;
+            std::vector<uint32_t> hashes;
+            fields >> name;
+            for (std::string hash; fields >> hash;) {
+                hashes.push_back(std::stoul(hash, nullptr, 16));
+            }
+            golden[name] = hashes;
+        }
+        return golden;
+    }
+
+    static void write_golden(const TestRgbMatrixLayout& layout, const std::map<std::string, std::vector<uint32_t>>& golden) {
+        std::ofstream file(golden_path(layout));
+        for (const Effect& effect : effects) {
+            file << effect.name;
+            for (uint32_t hash : golden.at(effect.name)) {
+                char text[10];
+                std::snprintf(text, sizeof(text), " %08x", hash);
+                file << text;
+            }
+            file << "\n";
+        }
+    }
+};
+
+/*
+ * Renders every effect on each layout, comparing the frames with the golden files and reporting
+ * the time spent per frame, so that changes to the effects, runners, color conversion or lib8tion
+ * can be checked to leave the output unchanged and measured.
+ */
+TEST_F(RgbMatrixEffects, MatchGoldenFrames) {
+    bool update = std::getenv(UPDATE_GOLDEN_ENV) != nullptr;
+
+    for (const TestRgbMatrixLayout& layout : test_rgb_matrix_layouts) {
+        std::memcpy(&g_led_config, &layout.config, sizeof(g_led_config));
+        std::map<std::string, std::vector<uint32_t>> golden = read_golden(layout);
+        std::map<std::string, std::vector<uint32_t>> rendered;
+        if (!update) {
+            ASSERT_FALSE(golden.empty()) << "no golden frames in " << golden_path(layout) << ", set " UPDATE_GOLDEN_ENV " to create them";
+        }
+
+        for (const Effect& effect : effects) {
+            // Every effect starts from the same state, whatever ran before it
+            srand(1);
+            random16_set_seed(1337);
+            rgb_matrix_init();
+            rgb_matrix_enable_noeeprom();
+            rgb_matrix_sethsv_noeeprom(HSV_RED);
+            rgb_matrix_set_speed_noeeprom(128);
+            rgb_matrix_mode_noeeprom(effect.mode);
+
+            std::vector<uint32_t>&   hashes = rendered[effect.name];
+            std::chrono::nanoseconds elapsed(0);
+            for (int frame = 0; frame < TIMED_FRAME_COUNT; frame++) {
+                elapsed += render_frame(frame);
+                if (frame < GOLDEN_FRAME_COUNT) {
+                    hashes.push_back(frame_hash());
+                }
+            }
+            std::printf("rgb_matrix %-10s %-26s %6.0f ns/frame\n", layout.name, effect.name, static_cast<double>(elapsed.count()) / TIMED_FRAME_COUNT);
+
+            if (update || (uses_libc_rand(effect.mode) && !compare_libc_rand)) {
+                continue;
+            }
+            const std::vector<uint32_t>& expected = golden[effect.name];
+            ASSERT_EQ(expected.size(), hashes.size()) << layout.name << " " << effect.name << " has no golden frames";
+            for (size_t frame = 0; frame < hashes.size(); frame++) {
+                if (hashes[frame] != expected[frame]) {
+                    ADD_FAILURE() << layout.name << " " << effect.name << " differs from frame " << frame;
+                    break;
+                }
+            }
+        }
+
+        if (update) {
+            write_golden(layout, rendered);
+        }
+    }
+}
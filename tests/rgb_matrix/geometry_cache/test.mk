@@ -0,0 +1,11 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs the tests in the parent directory with the LED geometry computed once at init
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+include tests/rgb_matrix/common/build.mk
+
+SRC += $(dir $(TEST_PATH))test_rgb_matrix_geometry.cpp
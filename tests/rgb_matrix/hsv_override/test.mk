@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Checks that the effect runners go through an overridden rgb_matrix_hsv_to_rgb()
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+include tests/rgb_matrix/common/build.mk
@@ -0,0 +1,50 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+namespace {
+uint32_t conversions;
+} // namespace
+
+extern "C" {
+// Passes the color through unconverted, so the driver sees the HSV the effect asked for
+RGB rgb_matrix_hsv_to_rgb(HSV hsv) {
+    conversions++;
+    return {hsv.h, hsv.s, hsv.v};
+}
+}
+
+class RgbMatrixHsvOverride : public TestFixture {};
+
+static void render_frame(void) {
+    advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+    // Syncing, starting, rendering and flushing one frame
+    for (int i = 0; i < 4; i++) {
+        rgb_matrix_task();
+    }
+}
+
+TEST_F(RgbMatrixHsvOverride, EffectRunnersUseTheOverride) {
+    const uint8_t modes[] = {RGB_MATRIX_GRADIENT_LEFT_RIGHT, RGB_MATRIX_CYCLE_ALL, RGB_MATRIX_BAND_SPIRAL_VAL};
+
+    rgb_matrix_sethsv_noeeprom(10, 123, 200);
+    for (uint8_t mode : modes) {
+        rgb_matrix_mode_noeeprom(mode);
+        rgb_matrix_driver.set_color_all(0, 0, 0);
+        conversions = 0;
+        for (int frame = 0; frame < 4; frame++) {
+            render_frame();
+        }
+
+        EXPECT_GE(conversions, RGB_MATRIX_LED_COUNT) << (int)mode;
+        for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            EXPECT_EQ(test_rgb_matrix_leds[i].g, 123) << (int)mode << " led " << i;
+        }
+    }
+}
@@ -0,0 +1,114 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixReactiveField : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_set_speed_noeeprom(128);
+    }
+
+    static void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        while (true) {
+            rgb_matrix_task();
+            if (rgb_matrix_time_until_next() > 0) {
+                break;
+            }
+        }
+    }
+
+    static void start(uint8_t mode) {
+        rgb_matrix_mode_noeeprom(mode);
+        render_frame();
+        render_frame();
+    }
+
+    static void press(uint8_t led) {
+        rgb_matrix_handle_key_event(led / MATRIX_COLS, led % MATRIX_COLS, true);
+    }
+
+    static uint8_t distance(uint8_t a, uint8_t b) {
+        int16_t dx = g_led_config.point[a].x - g_led_config.point[b].x;
+        int16_t dy = g_led_config.point[a].y - g_led_config.point[b].y;
+        return sqrt16(dx * dx + dy * dy);
+    }
+};
+
+TEST_F(RgbMatrixReactiveField, RingTravelsAtTheSplashSpeed) {
+    const uint8_t hit = 14;
+    start(RGB_MATRIX_MULTISPLASH);
+    press(hit);
+
+    for (int frame = 0; frame < 40; frame++) {
+        render_frame();
+
+        uint16_t tick;
+        ASSERT_TRUE(rgb_matrix_reactive_field_hit_tick(hit, &tick));
+        for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+            // Rings travel from LED to LED, which is a little further than the straight line
+            uint8_t  dist      = distance(hit, i);
+            uint16_t tolerance = dist / 8 + RGB_MATRIX_LED_FLUSH_LIMIT;
+            uint16_t ring;
+            bool     reached = rgb_matrix_reactive_field_ring_tick(i, &ring);
+            if (tick >= dist + tolerance) {
+                ASSERT_TRUE(reached) << "LED " << +i << " at frame " << frame;
+            }
+            if (tick + tolerance < dist) {
+                ASSERT_FALSE(reached) << "LED " << +i << " at frame " << frame;
+            }
+            if (reached) {
+                EXPECT_LE(ring, tick - dist + tolerance) << "LED " << +i;
+                EXPECT_GE(ring + tolerance, tick - dist) << "LED " << +i;
+            }
+        }
+    }
+}
+
+TEST_F(RgbMatrixReactiveField, EveryHitIsKept) {
+    start(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+
+    // Far more keys than LED_HITS_TO_REMEMBER in one frame
+    for (uint8_t led = 0; led < 3 * LED_HITS_TO_REMEMBER; led++) {
+        press(led);
+    }
+    render_frame();
+
+    for (uint8_t led = 0; led < RGB_MATRIX_LED_COUNT; led++) {
+        uint16_t tick;
+        EXPECT_EQ(rgb_matrix_reactive_field_hit_tick(led, &tick), led < 3 * LED_HITS_TO_REMEMBER) << "LED " << +led;
+    }
+}
+
+TEST_F(RgbMatrixReactiveField, HitsFadeAway) {
+    start(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    press(0);
+    render_frame();
+
+    uint16_t tick;
+    ASSERT_TRUE(rgb_matrix_reactive_field_hit_tick(0, &tick));
+    // Long enough for the age to wrap around, were it not held
+    for (int i = 0; i < 10000; i++) {
+        render_frame();
+    }
+    EXPECT_FALSE(rgb_matrix_reactive_field_hit_tick(0, &tick));
+}
+
+TEST_F(RgbMatrixReactiveField, StartingAnEffectClearsTheField) {
+    start(RGB_MATRIX_SOLID_REACTIVE_SIMPLE);
+    press(5);
+    render_frame();
+
+    start(RGB_MATRIX_MULTISPLASH);
+    uint16_t tick;
+    EXPECT_FALSE(rgb_matrix_reactive_field_hit_tick(5, &tick));
+    EXPECT_FALSE(rgb_matrix_reactive_field_ring_tick(5, &tick));
+}
@@ -0,0 +1,9 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "../config.h"
+
+// Four simulated milliseconds, as the test platform counts one cycle per millisecond
+#define RGB_MATRIX_RENDER_BUDGET_US 4000
@@ -0,0 +1,9 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Sizes the render slices to the measured cost of the effect instead of RGB_MATRIX_LED_PROCESS_LIMIT
+
+RGB_MATRIX_ENABLE = yes
+RGB_MATRIX_DRIVER = custom
+
+include tests/rgb_matrix/common/build.mk
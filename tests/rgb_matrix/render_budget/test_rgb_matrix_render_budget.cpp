@@ -0,0 +1,119 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <vector>
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.hpp"
+
+namespace {
+// Simulated milliseconds each rendered LED takes
+uint32_t cost_per_led;
+
+struct Slice {
+    uint8_t min;
+    uint8_t max;
+};
+std::vector<Slice> slices;
+} // namespace
+
+extern "C" {
+void advance_time(uint32_t ms);
+
+// Called after every slice with the LEDs it rendered, which is where the render cost is simulated
+bool rgb_matrix_indicators_advanced_user(uint8_t led_min, uint8_t led_max) {
+    slices.push_back({led_min, led_max});
+    advance_time(cost_per_led * (led_max - led_min));
+    return true;
+}
+}
+
+class RgbMatrixRenderBudget : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_SOLID_COLOR);
+    }
+
+    void TearDown() override {
+        cost_per_led = 0;
+    }
+
+    // Runs the task once per simulated millisecond, as a 1 kHz scan loop would
+    static void run_for(uint32_t ms) {
+        for (uint32_t i = 0; i < ms; i++) {
+            advance_time(1);
+            rgb_matrix_task();
+        }
+    }
+
+    // Runs until the calibration and cost measurement have settled, then records the slices of the next frames
+    static void settle_and_record(uint32_t ms) {
+        run_for(RGB_MATRIX_RENDER_STATS_INTERVAL);
+        slices.clear();
+        run_for(ms);
+    }
+
+    static void expect_frames_cover_every_led(void) {
+        // Recording may have started in the middle of a frame
+        auto    first = std::find_if(slices.begin(), slices.end(), [](const Slice &slice) { return slice.min == 0; });
+        uint8_t next  = 0;
+        ASSERT_NE(first, slices.end());
+        for (auto slice = first; slice != slices.end(); slice++) {
+            ASSERT_EQ(slice->min, next);
+            ASSERT_GT(slice->max, slice->min);
+            next = slice->max == RGB_MATRIX_LED_COUNT ? 0 : slice->max;
+        }
+    }
+};
+
+TEST_F(RgbMatrixRenderBudget, SlicesFitTheBudget) {
+    cost_per_led = 1;
+    settle_and_record(1000);
+
+    ASSERT_FALSE(slices.empty());
+    expect_frames_cover_every_led();
+    for (const Slice &slice : slices) {
+        EXPECT_EQ(slice.max - slice.min, 4);
+    }
+}
+
+TEST_F(RgbMatrixRenderBudget, SlicesFollowTheCost) {
+    cost_per_led = 2;
+    settle_and_record(1000);
+
+    ASSERT_FALSE(slices.empty());
+    expect_frames_cover_every_led();
+    EXPECT_EQ(slices.back().max - slices.back().min, 2);
+}
+
+TEST_F(RgbMatrixRenderBudget, CheapEffectsRenderInOneSlice) {
+    settle_and_record(1000);
+
+    ASSERT_FALSE(slices.empty());
+    for (const Slice &slice : slices) {
+        EXPECT_EQ(slice.min, 0);
+        EXPECT_EQ(slice.max, RGB_MATRIX_LED_COUNT);
+    }
+}
+
+TEST_F(RgbMatrixRenderBudget, ExpensiveEffectsStillProgress) {
+    // A single LED is over the budget
+    cost_per_led = 10;
+    settle_and_record(1000);
+
+    ASSERT_FALSE(slices.empty());
+    expect_frames_cover_every_led();
+    EXPECT_EQ(slices.back().max - slices.back().min, 1);
+}
+
+TEST_F(RgbMatrixRenderBudget, StatsReportFramesAndStalls) {
+    cost_per_led = 1;
+    // The statistics of the last interval are only from after the cost has settled
+    run_for(RGB_MATRIX_RENDER_STATS_INTERVAL * 3);
+
+    const rgb_matrix_render_stats_t *stats = rgb_matrix_get_render_stats();
+    EXPECT_EQ(stats->slice_leds, 4);
+    EXPECT_EQ(stats->max_stall_us, 4000);
+    EXPECT_GT(stats->fps, 0);
+    EXPECT_LE(stats->fps, 1000 / RGB_MATRIX_LED_FLUSH_LIMIT);
+}
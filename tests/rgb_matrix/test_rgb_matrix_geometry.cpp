@@ -0,0 +1,92 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include "test_common.hpp"
+#include "test_rgb_matrix_driver.hpp"
+
+#define FRAME_COUNT 2000
+
+namespace {
+uint64_t frame_hash;
+uint32_t frames;
+
+// Folds every flushed frame into a FNV-1a hash
+void hash_frame(void) {
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(test_rgb_matrix_leds);
+    for (size_t i = 0; i < sizeof(test_rgb_matrix_leds); i++) {
+        frame_hash ^= data[i];
+        frame_hash *= 1099511628211ULL;
+    }
+    frames++;
+}
+} // namespace
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+struct GeometryEffect {
+    uint8_t     mode;
+    const char* name;
+    uint64_t    hash;
+};
+
+// Hashes of FRAME_COUNT frames of each effect, which must not depend on RGB_MATRIX_GEOMETRY_CACHE
+static const GeometryEffect geometry_effects[] = {
+    {RGB_MATRIX_BAND_PINWHEEL_SAT, "BAND_PINWHEEL_SAT", 0x8df79699bc4e1fa2ULL},
+    {RGB_MATRIX_BAND_PINWHEEL_VAL, "BAND_PINWHEEL_VAL", 0xbfc267e0704b0a46ULL},
+    {RGB_MATRIX_BAND_SPIRAL_SAT, "BAND_SPIRAL_SAT", 0x5e9bd949f0c7f44eULL},
+    {RGB_MATRIX_BAND_SPIRAL_VAL, "BAND_SPIRAL_VAL", 0xd57404ca720a885eULL},
+    {RGB_MATRIX_CYCLE_OUT_IN, "CYCLE_OUT_IN", 0xea5620792d6a6681ULL},
+    {RGB_MATRIX_CYCLE_OUT_IN_DUAL, "CYCLE_OUT_IN_DUAL", 0x313c1f9a475a0d19ULL},
+    {RGB_MATRIX_CYCLE_PINWHEEL, "CYCLE_PINWHEEL", 0xcd67f5c0cd964e7fULL},
+    {RGB_MATRIX_CYCLE_SPIRAL, "CYCLE_SPIRAL", 0x4e80330e4cfc3ccbULL},
+    {RGB_MATRIX_DUAL_BEACON, "DUAL_BEACON", 0x060012f95f42539dULL},
+    {RGB_MATRIX_RAINBOW_BEACON, "RAINBOW_BEACON", 0x5aee4264a5c76617ULL},
+    {RGB_MATRIX_RAINBOW_PINWHEELS, "RAINBOW_PINWHEELS", 0x9e950f6e75611469ULL},
+};
+
+class RgbMatrixGeometry : public TestFixture {
+   protected:
+    void SetUp() override {
+        test_rgb_matrix_flush_hook = hash_frame;
+    }
+
+    void TearDown() override {
+        test_rgb_matrix_flush_hook = nullptr;
+    }
+};
+
+/*
+ * Renders every effect using the LED geometry and reports the time spent per frame, so
+ * that this target and geometry_cache can be compared.
+ */
+TEST_F(RgbMatrixGeometry, EffectsRenderTheSameFrames) {
+#ifdef RGB_MATRIX_GEOMETRY_CACHE
+    const char* variant = "cached";
+#else
+    const char* variant = "computed";
+#endif
+
+    for (const GeometryEffect& effect : geometry_effects) {
+        rgb_matrix_mode_noeeprom(effect.mode);
+        frame_hash = 14695981039346656037ULL;
+        frames     = 0;
+
+        std::chrono::nanoseconds elapsed(0);
+        while (frames < FRAME_COUNT) {
+            advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+            auto start = std::chrono::steady_clock::now();
+            // Syncing, starting, rendering and flushing one frame
+            for (int i = 0; i < 4; i++) {
+                rgb_matrix_task();
+            }
+            elapsed += std::chrono::steady_clock::now() - start;
+        }
+
+        std::printf("rgb_matrix %-8s %-18s %6.0f ns/frame, hash 0x%016llx\n", variant, effect.name, static_cast<double>(elapsed.count()) / frames, (unsigned long long)frame_hash);
+        EXPECT_EQ(frame_hash, effect.hash) << effect.name;
+    }
+}
@@ -0,0 +1,101 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <cstring>
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "lib/lib8tion/lib8tion.h"
+
+void advance_time(uint32_t ms);
+}
+
+class RgbMatrixTypingHeatmap : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgb_matrix_mode_noeeprom(RGB_MATRIX_TYPING_HEATMAP);
+        render_frame();
+        memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+        memset(expected, 0, sizeof expected);
+    }
+
+    uint8_t expected[MATRIX_ROWS][MATRIX_COLS];
+
+    static void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        while (true) {
+            rgb_matrix_task();
+            if (rgb_matrix_time_until_next() > 0) {
+                break;
+            }
+        }
+    }
+
+    // The heat spread by a press, measuring the distance to every other key
+    void press_expected(uint8_t row, uint8_t col) {
+        expected[row][col] = qadd8(expected[row][col], RGB_MATRIX_TYPING_HEATMAP_INCREASE_STEP);
+        for (uint8_t i_row = 0; i_row < MATRIX_ROWS; i_row++) {
+            for (uint8_t i_col = 0; i_col < MATRIX_COLS; i_col++) {
+                if (i_row == row && i_col == col) {
+                    continue;
+                }
+                led_point_t a        = g_led_config.point[g_led_config.matrix_co[row][col]];
+                led_point_t b        = g_led_config.point[g_led_config.matrix_co[i_row][i_col]];
+                uint8_t     distance = sqrt16((a.x - b.x) * (a.x - b.x) + (a.y - b.y) * (a.y - b.y));
+                if (distance <= RGB_MATRIX_TYPING_HEATMAP_SPREAD) {
+                    uint8_t amount          = std::min<uint8_t>(RGB_MATRIX_TYPING_HEATMAP_SPREAD - distance, RGB_MATRIX_TYPING_HEATMAP_AREA_LIMIT);
+                    expected[i_row][i_col] = qadd8(expected[i_row][i_col], amount);
+                }
+            }
+        }
+    }
+
+    void expect_heat(void) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+                ASSERT_EQ(g_rgb_frame_buffer[row][col], expected[row][col]) << "row " << +row << " col " << +col;
+            }
+        }
+    }
+};
+
+TEST_F(RgbMatrixTypingHeatmap, EveryKeySpreadsLikeBefore) {
+    // The first keys use the neighbor lists, the last ones did not fit them
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
+            memset(expected, 0, sizeof expected);
+            rgb_matrix_handle_key_event(row, col, true);
+            press_expected(row, col);
+            expect_heat();
+        }
+    }
+}
+
+TEST_F(RgbMatrixTypingHeatmap, HeatSaturates) {
+    for (int i = 0; i < 20; i++) {
+        rgb_matrix_handle_key_event(1, 4, true);
+        press_expected(1, 4);
+        rgb_matrix_handle_key_event(2, 5, true);
+        press_expected(2, 5);
+    }
+    expect_heat();
+    EXPECT_EQ(g_rgb_frame_buffer[1][4], 255);
+}
+
+TEST_F(RgbMatrixTypingHeatmap, OnlyHotKeysCoolDown) {
+    rgb_matrix_handle_key_event(0, 0, true);
+    press_expected(0, 0);
+
+    advance_time(RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS);
+    render_frame();
+    for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS; col++) {
+            if (expected[row][col]) {
+                expected[row][col]--;
+            }
+        }
+    }
+    expect_heat();
+}
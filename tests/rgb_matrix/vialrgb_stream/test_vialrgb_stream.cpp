@@ -0,0 +1,177 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <vector>
+#include "test_common.hpp"
+
+extern "C" {
+#include "rgb_matrix.h"
+#include "vial.h"
+#include "vialrgb.h"
+
+extern HSV g_direct_mode_colors[RGB_MATRIX_LED_COUNT];
+
+void advance_time(uint32_t ms);
+}
+
+// VIALRGB_EFFECT_DIRECT, vialrgb_effects.inc is private to vialrgb.c
+#define EFFECT_DIRECT 1
+
+struct StreamReply {
+    uint8_t status;
+    uint8_t shown_seq;
+    uint8_t dropped;
+};
+
+class VialRgbStream : public TestFixture {
+   protected:
+    void SetUp() override {
+        uint8_t data[VIAL_RAW_EPSIZE] = {0, vialrgb_set_mode, EFFECT_DIRECT, 0, 128, 0, 0, 0};
+        vialrgb_set_value(data, sizeof(data));
+        render_frame();
+        // Starts from the frame on display, whatever the previous test streamed
+        send(seq, vialrgb_stream_hsv, leds(0, {}));
+        dropped = send(seq, vialrgb_stream_commit, {}).dropped;
+        render_frame();
+        seq++;
+    }
+
+    uint8_t seq = 0;
+    uint8_t dropped;
+
+    static void render_frame(void) {
+        advance_time(RGB_MATRIX_LED_FLUSH_LIMIT);
+        while (true) {
+            rgb_matrix_task();
+            if (rgb_matrix_time_until_next() > 0) {
+                break;
+            }
+        }
+    }
+
+    static StreamReply send(uint8_t seq, uint8_t format, std::vector<uint8_t> payload) {
+        uint8_t data[VIAL_RAW_EPSIZE] = {0, vialrgb_direct_stream, seq, format};
+        std::copy(payload.begin(), payload.end(), &data[4]);
+        vialrgb_set_value(data, sizeof(data));
+        return {data[3], data[4], data[5]};
+    }
+
+    static std::vector<uint8_t> leds(uint16_t first, std::vector<HSV> colors) {
+        std::vector<uint8_t> payload = {static_cast<uint8_t>(first), static_cast<uint8_t>(first >> 8), static_cast<uint8_t>(colors.size())};
+        for (const HSV &color : colors) {
+            payload.insert(payload.end(), {color.h, color.s, color.v});
+        }
+        return payload;
+    }
+
+    static void expect_led(uint8_t led, HSV expected) {
+        EXPECT_EQ(g_direct_mode_colors[led].h, expected.h) << "LED " << +led;
+        EXPECT_EQ(g_direct_mode_colors[led].s, expected.s) << "LED " << +led;
+        EXPECT_EQ(g_direct_mode_colors[led].v, expected.v) << "LED " << +led;
+    }
+};
+
+TEST_F(VialRgbStream, FullFrame) {
+    for (uint8_t first = 0; first < RGB_MATRIX_LED_COUNT; first += 8) {
+        std::vector<HSV> colors;
+        for (uint8_t i = first; i < first + 8; i++) {
+            colors.push_back({i, static_cast<uint8_t>(i * 2), static_cast<uint8_t>(i * 3)});
+        }
+        EXPECT_EQ(send(seq, vialrgb_stream_hsv, leds(first, colors)).status, vialrgb_stream_ok);
+    }
+    EXPECT_EQ(send(seq, vialrgb_stream_commit, {}).status, vialrgb_stream_ok);
+    render_frame();
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        expect_led(i, {i, static_cast<uint8_t>(i * 2), static_cast<uint8_t>(i * 3)});
+    }
+}
+
+TEST_F(VialRgbStream, FrameIsShownOnlyOnceCommitted) {
+    send(seq, vialrgb_stream_hsv, leds(3, {{10, 20, 30}}));
+    render_frame();
+    EXPECT_NE(g_direct_mode_colors[3].h, 10);
+
+    // Committed frames wait for the start of the next rendered frame
+    StreamReply reply = send(seq, vialrgb_stream_commit, {});
+    EXPECT_EQ(reply.shown_seq, static_cast<uint8_t>(seq - 1));
+    EXPECT_NE(g_direct_mode_colors[3].h, 10);
+
+    render_frame();
+    expect_led(3, {10, 20, 30});
+    EXPECT_EQ(send(seq + 1, vialrgb_stream_hsv, leds(4, {{1, 1, 1}})).shown_seq, seq);
+}
+
+TEST_F(VialRgbStream, PaletteIndexed) {
+    EXPECT_EQ(send(seq, vialrgb_stream_palette, {0, 3, 1, 2, 3, 4, 5, 6, 7, 8, 9}).status, vialrgb_stream_ok);
+    EXPECT_EQ(send(seq, vialrgb_stream_palette, {15, 1, 100, 110, 120}).status, vialrgb_stream_ok);
+
+    // Indices 0, 1, 2, 15 from LED 36
+    EXPECT_EQ(send(seq, vialrgb_stream_indexed, {36, 0, 4, 0x10, 0xF2}).status, vialrgb_stream_ok);
+    // 50 LEDs fit in a packet, which is more than there are
+    std::vector<uint8_t> payload = {0, 0, 36};
+    payload.insert(payload.end(), 18, 0x21);
+    EXPECT_EQ(send(seq, vialrgb_stream_indexed, payload).status, vialrgb_stream_ok);
+    send(seq, vialrgb_stream_commit, {});
+    render_frame();
+
+    for (uint8_t i = 0; i < 36; i++) {
+        expect_led(i, i % 2 ? HSV{7, 8, 9} : HSV{4, 5, 6});
+    }
+    expect_led(36, {1, 2, 3});
+    expect_led(37, {4, 5, 6});
+    expect_led(38, {7, 8, 9});
+    expect_led(39, {100, 110, 120});
+}
+
+TEST_F(VialRgbStream, DeltaKeepsUnchangedLeds) {
+    std::vector<HSV> colors(8, {50, 60, 70});
+    for (uint8_t first = 0; first < RGB_MATRIX_LED_COUNT; first += 8) {
+        send(seq, vialrgb_stream_hsv, leds(first, colors));
+    }
+    send(seq, vialrgb_stream_commit, {});
+    seq++;
+
+    // LEDs 12 and 13, then 20, the frame builds on the committed one even before it is shown
+    EXPECT_EQ(send(seq, vialrgb_stream_delta, {10, 0, 2, 2, 1, 1, 1, 2, 2, 2, 6, 1, 3, 3, 3}).status, vialrgb_stream_ok);
+    send(seq, vialrgb_stream_commit, {});
+    render_frame();
+
+    for (uint8_t i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        if (i == 12) {
+            expect_led(i, {1, 1, 1});
+        } else if (i == 13) {
+            expect_led(i, {2, 2, 2});
+        } else if (i == 20) {
+            expect_led(i, {3, 3, 3});
+        } else {
+            expect_led(i, {50, 60, 70});
+        }
+    }
+}
+
+TEST_F(VialRgbStream, SupersededFrameIsDropped) {
+    send(seq, vialrgb_stream_hsv, leds(0, {{1, 1, 1}}));
+    send(seq, vialrgb_stream_commit, {});
+    send(seq + 1, vialrgb_stream_hsv, leds(1, {{2, 2, 2}}));
+    StreamReply reply = send(seq + 1, vialrgb_stream_commit, {});
+    EXPECT_EQ(reply.dropped, static_cast<uint8_t>(dropped + 1));
+    render_frame();
+
+    // The dropped frame is still the base of the one shown
+    expect_led(0, {1, 1, 1});
+    expect_led(1, {2, 2, 2});
+    EXPECT_EQ(send(seq + 2, vialrgb_stream_hsv, leds(2, {})).shown_seq, static_cast<uint8_t>(seq + 1));
+}
+
+TEST_F(VialRgbStream, InvalidPackets) {
+    // Past the last LED
+    EXPECT_EQ(send(seq, vialrgb_stream_hsv, leds(RGB_MATRIX_LED_COUNT - 1, {{1, 1, 1}, {2, 2, 2}})).status, vialrgb_stream_invalid);
+    // More LEDs than the packet holds
+    EXPECT_EQ(send(seq, vialrgb_stream_hsv, {0, 0, 9}).status, vialrgb_stream_invalid);
+    EXPECT_EQ(send(seq, vialrgb_stream_palette, {15, 2, 1, 1, 1, 1, 1, 1}).status, vialrgb_stream_invalid);
+    EXPECT_EQ(send(seq, vialrgb_stream_delta, {38, 0, 0, 3, 1, 1, 1, 2, 2, 2, 3, 3, 3}).status, vialrgb_stream_invalid);
+    EXPECT_EQ(send(seq, 0x7F, {}).status, vialrgb_stream_invalid);
+    // Committing a frame that was never started
+    EXPECT_EQ(send(seq + 5, vialrgb_stream_commit, {}).status, vialrgb_stream_invalid);
+}
@@ -0,0 +1,6 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+# Runs the tests in the parent directory with tick events suppressed while idle
+
+SRC += $(dir $(TEST_PATH))test_neutralization.cpp $(dir $(TEST_PATH))test_tap_hold.cpp $(dir $(TEST_PATH))test_tapping.cpp
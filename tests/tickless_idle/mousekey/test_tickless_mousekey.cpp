@@ -0,0 +1,28 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class TicklessMousekey : public TestFixture {};
+
+TEST_F(TicklessMousekey, polls_while_moving) {
+    TestDriver driver;
+    auto       mouse_key = KeymapKey(0, 1, 0, KC_MS_U);
+    set_keymap({mouse_key});
+    EXPECT_CALL(driver, send_mouse_mock(_)).Times(AnyNumber());
+
+    mouse_key.press();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_time_until_next(), 0);
+
+    mouse_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,8 @@
+# Copyright 2024 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CAPS_WORD_ENABLE = yes
+DEFERRED_EXEC_ENABLE = yes
+TAP_DANCE_ENABLE = yes
+
+SRC += tap_dance.c
@@ -0,0 +1,131 @@
+// Copyright 2024 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+using testing::AnyNumber;
+
+class TicklessIdle : public TestFixture {};
+
+TEST_F(TicklessIdle, idle_keyboard_has_no_deadline) {
+    TestDriver driver;
+
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+}
+
+TEST_F(TicklessIdle, mod_tap_reports_tapping_term) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, LSFT_T(KC_A));
+    set_keymap({mod_tap_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    mod_tap_key.press();
+    run_one_scan_loop();
+    uint32_t next = keyboard_time_until_next();
+    EXPECT_GT(next, 0);
+    EXPECT_LE(next, TAPPING_TERM);
+
+    /* Nothing happens until the deadline, after which the key is held. */
+    idle_for(next - 1);
+    EXPECT_EQ(get_mods(), 0);
+    idle_for(2);
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LSFT));
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+
+    mod_tap_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TicklessIdle, tapped_key_waits_for_quick_tap) {
+    TestDriver driver;
+    auto       mod_tap_key = KeymapKey(0, 1, 0, LSFT_T(KC_A));
+    set_keymap({mod_tap_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    tap_key(mod_tap_key);
+    EXPECT_NE(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    idle_for(TAPPING_TERM + 1);
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TicklessIdle, one_shot_mod_reports_timeout) {
+    TestDriver driver;
+    auto       osm_key = KeymapKey(0, 0, 0, OSM(MOD_LSFT));
+    set_keymap({osm_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    tap_key(osm_key);
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LSFT));
+
+    /* Once the tapping term has passed, only the one shot timeout is pending. */
+    idle_for(TAPPING_TERM);
+    uint32_t next = keyboard_time_until_next();
+    EXPECT_GT(next, 0);
+    EXPECT_LE(next, ONESHOT_TIMEOUT - TAPPING_TERM);
+
+    idle_for(next - 1);
+    EXPECT_EQ(get_oneshot_mods(), MOD_BIT(KC_LSFT));
+    idle_for(2);
+    EXPECT_EQ(get_oneshot_mods(), 0);
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(TicklessIdle, caps_word_reports_idle_timeout) {
+    TestDriver driver;
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    caps_word_on();
+    EXPECT_EQ(keyboard_time_until_next(), CAPS_WORD_IDLE_TIMEOUT);
+    idle_for(100);
+    EXPECT_EQ(keyboard_time_until_next(), CAPS_WORD_IDLE_TIMEOUT - 100);
+
+    idle_for(CAPS_WORD_IDLE_TIMEOUT);
+    EXPECT_FALSE(is_caps_word_on());
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
+
+static uint32_t noop_callback(uint32_t trigger_time, void *cb_arg) {
+    return 0;
+}
+
+TEST_F(TicklessIdle, deferred_exec_reports_deadline) {
+    TestDriver driver;
+
+    deferred_token token = defer_exec(50, noop_callback, NULL);
+    EXPECT_EQ(keyboard_time_until_next(), 50);
+    idle_for(20);
+    EXPECT_EQ(keyboard_time_until_next(), 30);
+    cancel_deferred_exec(token);
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+}
+
+TEST_F(TicklessIdle, finished_tap_dance_waits_for_release) {
+    TestDriver driver;
+    auto       dance_key = KeymapKey(0, 1, 0, TD(0));
+    set_keymap({dance_key});
+    EXPECT_ANY_REPORT(driver).Times(AnyNumber());
+
+    dance_key.press();
+    run_one_scan_loop();
+    EXPECT_LE(keyboard_time_until_next(), TAPPING_TERM);
+
+    /* The dance has finished, and holding its key does not need any ticks. */
+    idle_for(TAPPING_TERM + 1);
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+
+    dance_key.release();
+    run_one_scan_loop();
+    EXPECT_EQ(keyboard_time_until_next(), TIMER_NO_DEADLINE);
+    VERIFY_AND_CLEAR(driver);
+}
@@ -28,6 +28,7 @@ def to_lut(values):
         print(hex(int(v)), end=", ")
 
 
+import sys
 from math import sin, tau, pi
 
 samples=[]
@@ -60,8 +61,49 @@ def sampleTrapezoidal():
         samples.append(s)
 
 
-#sampleSine()
-sampleTrapezoidal()
-#print(samples)
-plot(samples)
-to_lut(samples)
+def to_header(tables):
+    print('// Copyright 2024 QMK')
+    print('// SPDX-License-Identifier: GPL-2.0-or-later')
+    print()
+    print('// Generated by util/audio_generate_dac_lut.py --mixer, do not edit')
+    print()
+    print('#pragma once')
+    print()
+    print('#include <stdint.h>')
+    print()
+    print('#define AUDIO_MIXER_WAVETABLE_SIZE %d' % AUDIO_DAC_BUFFER_SIZE)
+    for name, values in tables:
+        print()
+        print('// One period of a %s wave, starting at zero and rising, as signed Q15' % name)
+        print('static const int16_t audio_mixer_wavetable_%s[AUDIO_MIXER_WAVETABLE_SIZE] = {' % name)
+        for i in range(0, len(values), 16):
+            print('    ' + ', '.join('%6d' % v for v in values[i:i + 16]) + ',')
+        print('};')
+
+# signed, zero centered waveforms for the mixer, starting at zero so voices start silently
+def mixerTriangle(t):
+    if t < 0.25:
+        return 4 * t
+    if t < 0.75:
+        return 2 - 4 * t
+    return 4 * t - 4
+
+def mixerTables():
+    waves = [
+        ('sine', lambda t: sin(t * tau)),
+        ('triangle', mixerTriangle),
+        ('trapezoid', lambda t: max(-1, min(1, 3 * mixerTriangle(t)))),
+        ('square', lambda t: 1 if t < 0.5 else -1),
+    ]
+    return [(name, [round(wave(s / AUDIO_DAC_BUFFER_SIZE) * 32767) for s in range(AUDIO_DAC_BUFFER_SIZE)]) for name, wave in waves]
+
+
+if '--mixer' in sys.argv:
+    # quantum/audio/audio_mixer_wavetables.h
+    to_header(mixerTables())
+else:
+    #sampleSine()
+    sampleTrapezoidal()
+    #print(samples)
+    plot(samples)
+    to_lut(samples)